@@ -0,0 +1,164 @@
+// Copyright 2026 Michael DiLucca.
+
+#include "RCAsyncHitQuerySubsystem.h"
+
+#include "RCCharacter.h"
+#include "RCCharacterStats.h"
+#include "RCShieldComponent.h"
+#include "Engine/OverlapResult.h"
+#include "Engine/World.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Async Hit Queries"), STAT_RCAsyncHitQueries, STATGROUP_RCCharacter);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Async Hit Queries Dropped"), STAT_RCAsyncHitQueriesDropped, STATGROUP_RCCharacter);
+
+/** Enough for a melee swing through a crowd, more spills to the heap. */
+using FRCHitActorArray = TArray<AActor*, TInlineAllocator<16>>;
+
+struct URCAsyncHitQuerySubsystem::FQueryStorage
+{
+	struct FPendingQuery
+	{
+		TWeakObjectPtr<AActor> Instigator;
+		FRCDamageEvent DamageEvent;
+	};
+
+	/** Entries are reused so steady-state queries don't allocate. */
+	TArray<FPendingQuery> Queries;
+	TArray<uint32> FreeQueries;
+
+	/** Everything but level geometry is reported as a touch, so a sweep carries on through a whole crowd. */
+	FCollisionResponseParams SweepResponse;
+};
+
+void URCAsyncHitQuerySubsystem::QueueSweep(AActor* Instigator, const FRCDamageEvent& DamageEvent,
+                                           const FVector& Start, const FVector& End, const FQuat& Rotation,
+                                           ECollisionChannel Channel, const FCollisionShape& Shape,
+                                           const FCollisionQueryParams& Params)
+{
+	if (!Storage) return;
+
+	GetWorld()->AsyncSweepByChannel(EAsyncTraceType::Multi, Start, End, Rotation, Channel, Shape, Params,
+	                                Storage->SweepResponse, &SweepDelegate, AddQuery(Instigator, DamageEvent));
+}
+
+void URCAsyncHitQuerySubsystem::QueueOverlap(AActor* Instigator, const FRCDamageEvent& DamageEvent,
+                                             const FVector& Location, const FQuat& Rotation,
+                                             ECollisionChannel Channel, const FCollisionShape& Shape,
+                                             const FCollisionQueryParams& Params)
+{
+	if (!Storage) return;
+
+	GetWorld()->AsyncOverlapByChannel(Location, Rotation, Channel, Shape, Params,
+	                                  FCollisionResponseParams::DefaultResponseParam, &OverlapDelegate,
+	                                  AddQuery(Instigator, DamageEvent));
+}
+
+void URCAsyncHitQuerySubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	Storage = MakePimpl<FQueryStorage>();
+	Storage->SweepResponse.CollisionResponse.SetAllChannels(ECR_Overlap);
+	Storage->SweepResponse.CollisionResponse.SetResponse(ECC_WorldStatic, ECR_Block);
+	SweepDelegate.BindUObject(this, &URCAsyncHitQuerySubsystem::OnSweepCompleted);
+	OverlapDelegate.BindUObject(this, &URCAsyncHitQuerySubsystem::OnOverlapCompleted);
+}
+
+void URCAsyncHitQuerySubsystem::Deinitialize()
+{
+	// Traces still in flight find the delegates unbound and are discarded
+	SweepDelegate.Unbind();
+	OverlapDelegate.Unbind();
+	Storage.Reset();
+
+	Super::Deinitialize();
+}
+
+int32 URCAsyncHitQuerySubsystem::GetNumPending() const
+{
+	return Storage ? Storage->Queries.Num() - Storage->FreeQueries.Num() : 0;
+}
+
+bool URCAsyncHitQuerySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+uint32 URCAsyncHitQuerySubsystem::AddQuery(AActor* Instigator, const FRCDamageEvent& DamageEvent)
+{
+	INC_DWORD_STAT(STAT_RCAsyncHitQueries);
+
+	TArray<FQueryStorage::FPendingQuery>& Queries = Storage->Queries;
+	TArray<uint32>& FreeQueries = Storage->FreeQueries;
+	const uint32 QueryIndex = !FreeQueries.IsEmpty() ? FreeQueries.Pop(EAllowShrinking::No) : Queries.AddDefaulted();
+	FQueryStorage::FPendingQuery& Query = Queries[QueryIndex];
+	Query.Instigator = Instigator;
+	Query.DamageEvent = DamageEvent;
+	return QueryIndex;
+}
+
+void URCAsyncHitQuerySubsystem::OnSweepCompleted(const FTraceHandle& Handle, FTraceDatum& Datum)
+{
+	// A hit on a raised shield reports its wielder as the hit actor, the wielder is blocked instead of damaged
+	FRCHitActorArray HitActors;
+	FRCHitActorArray ShieldedActors;
+	for (const FHitResult& Hit : Datum.OutHits)
+	{
+		if (AActor* HitActor = Hit.GetActor())
+		{
+			(URCShieldComponent::IsShieldHit(Hit) ? ShieldedActors : HitActors).AddUnique(HitActor);
+		}
+	}
+	for (AActor* ShieldedActor : ShieldedActors)
+	{
+		HitActors.Remove(ShieldedActor);
+	}
+	ApplyHits(Datum.UserData, HitActors);
+}
+
+void URCAsyncHitQuerySubsystem::OnOverlapCompleted(const FTraceHandle& Handle, FOverlapDatum& Datum)
+{
+	FRCHitActorArray HitActors;
+	FRCHitActorArray ShieldedActors;
+	for (const FOverlapResult& Overlap : Datum.OutOverlaps)
+	{
+		if (AActor* HitActor = Overlap.GetActor())
+		{
+			const URCShieldComponent* Shield = Cast<URCShieldComponent>(Overlap.GetComponent());
+			(Shield && Shield->IsShieldRaised() ? ShieldedActors : HitActors).AddUnique(HitActor);
+		}
+	}
+	for (AActor* ShieldedActor : ShieldedActors)
+	{
+		HitActors.Remove(ShieldedActor);
+	}
+	ApplyHits(Datum.UserData, HitActors);
+}
+
+void URCAsyncHitQuerySubsystem::ApplyHits(uint32 QueryIndex, TConstArrayView<AActor*> HitActors)
+{
+	if (!Storage || !Storage->Queries.IsValidIndex(QueryIndex)) return;
+
+	// Free the entry first, damage applied below may queue further queries
+	FQueryStorage::FPendingQuery Query = MoveTemp(Storage->Queries[QueryIndex]);
+	Storage->Queries[QueryIndex].Instigator.Reset();
+	Storage->FreeQueries.Add(QueryIndex);
+
+	// An attacker that died or went back to its pool since the swing doesn't land it
+	const AActor* Instigator = Query.Instigator.Get();
+	if (!IsValid(Instigator) || Instigator->IsHidden())
+	{
+		INC_DWORD_STAT(STAT_RCAsyncHitQueriesDropped);
+		return;
+	}
+
+	for (AActor* HitActor : HitActors)
+	{
+		if (HitActor != Instigator && IsValid(HitActor) && HitActor->Implements<URCDamageableInterface>())
+		{
+			// Each target gets its own copy, the damage interface may modify the event
+			FRCDamageEvent DamageEvent = Query.DamageEvent;
+			IRCDamageableInterface::Execute_ApplyDamageEvent(HitActor, DamageEvent);
+		}
+	}
+}
@@ -0,0 +1,65 @@
+// Copyright 2026 Michael DiLucca.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "WorldCollision.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Templates/PimplPtr.h"
+#include "RCAsyncHitQuerySubsystem.generated.h"
+
+struct FRCDamageEvent;
+
+/**
+ * Runs melee hit sweeps and overlaps through the world's async trace batch instead of on the game thread.
+ * Meant for URCMeleeAttackComponent's hit detection during a swing's active frames, in place of its synchronous
+ * traces, so melee damage keeps a single path.
+ * Every query issued during a frame is traced on the physics worker threads alongside the others, and the
+ * damage event is applied to each damageable actor it found when the results come back at the start of the
+ * next frame. A query whose instigator is gone by then is dropped.
+ */
+UCLASS()
+class URCAsyncHitQuerySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Sweep Shape from Start to End and apply DamageEvent to every damageable actor along the way. Only level geometry
+	 * stops the sweep, pawns and other dynamic bodies are touched, so one swing can hit a whole crowd.
+	 */
+	void QueueSweep(AActor* Instigator, const FRCDamageEvent& DamageEvent, const FVector& Start, const FVector& End,
+	                const FQuat& Rotation, ECollisionChannel Channel, const FCollisionShape& Shape,
+	                const FCollisionQueryParams& Params);
+
+	/** Overlap Shape at Location and apply DamageEvent to every damageable actor it finds. */
+	void QueueOverlap(AActor* Instigator, const FRCDamageEvent& DamageEvent, const FVector& Location,
+	                  const FQuat& Rotation, ECollisionChannel Channel, const FCollisionShape& Shape,
+	                  const FCollisionQueryParams& Params);
+
+	int32 GetNumPending() const;
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FQueryStorage;
+
+	/** Store a query and return the index its results are matched back with. */
+	uint32 AddQuery(AActor* Instigator, const FRCDamageEvent& DamageEvent);
+
+	void OnSweepCompleted(const FTraceHandle& Handle, FTraceDatum& Datum);
+	void OnOverlapCompleted(const FTraceHandle& Handle, FOverlapDatum& Datum);
+
+	/** Apply the query's damage once to each damageable actor in HitActors, then free the query. */
+	void ApplyHits(uint32 QueryIndex, TConstArrayView<AActor*> HitActors);
+
+	FTraceDelegate SweepDelegate;
+	FOverlapDelegate OverlapDelegate;
+
+	/** Queries in flight, indexed by trace user data. Kept out of the header so it doesn't need the damage types. */
+	TPimplPtr<FQueryStorage> Storage;
+};
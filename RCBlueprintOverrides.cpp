@@ -0,0 +1,20 @@
+// Copyright 2026 Michael DiLucca.
+
+#include "RCBlueprintOverrides.h"
+
+void FRCBlueprintOverrides::Initialize(const UClass* Class, const UClass* NativeClass,
+                                       TConstArrayView<FName> FunctionNames)
+{
+	check(FunctionNames.Num() == static_cast<int32>(ERCNativeHandler::Count));
+
+	OverriddenMask = 0;
+	for (int32 Index = 0; Index < FunctionNames.Num(); ++Index)
+	{
+		// A Blueprint override is a function of the same name owned by the Blueprint generated class
+		const UFunction* Function = Class->FindFunctionByName(FunctionNames[Index]);
+		if (Function && Function->GetOuter() != NativeClass)
+		{
+			OverriddenMask |= ToBit(static_cast<ERCNativeHandler>(Index));
+		}
+	}
+}
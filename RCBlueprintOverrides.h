@@ -0,0 +1,49 @@
+// Copyright 2026 Michael DiLucca.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** BlueprintNativeEvent handlers on ARCCharacter that input and internal paths call. */
+enum class ERCNativeHandler : uint8
+{
+	JumpOrDrop,
+	ReleaseJump,
+	CrouchDrop,
+	StopCrouchDrop,
+	Dash,
+	RangedAttack,
+	ReleaseRangedAttack,
+	MeleeAttack,
+	ReleaseMeleeAttack,
+	ActivateShield,
+	ReleaseShield,
+	ActivateHeal,
+	ReleaseHeal,
+	PauseGame,
+	OpenMenu,
+	SwapEquippable,
+
+	Count
+};
+
+/**
+ * Which BlueprintNativeEvents a class overrides in Blueprint, looked up once per instance.
+ * Events that aren't overridden can call their _Implementation directly and skip the script thunk.
+ * C++ overrides are unaffected since _Implementation is virtual.
+ */
+struct FRCBlueprintOverrides
+{
+	/** Look up FunctionNames, indexed by ERCNativeHandler, on Class. Anything not declared by NativeClass is an override. */
+	void Initialize(const UClass* Class, const UClass* NativeClass, TConstArrayView<FName> FunctionNames);
+
+	bool IsOverridden(ERCNativeHandler Handler) const { return (OverriddenMask & ToBit(Handler)) != 0; }
+
+private:
+	static uint32 ToBit(ERCNativeHandler Handler) { return 1u << static_cast<uint32>(Handler); }
+
+	/** Until initialized everything counts as overridden, so calls take the safe path. */
+	uint32 OverriddenMask = MAX_uint32;
+};
+
+static_assert(static_cast<int32>(ERCNativeHandler::Count) <= 32, "FRCBlueprintOverrides stores one bit per handler");
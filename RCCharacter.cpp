@@ -3,22 +3,53 @@
 #include "RCCharacter.h"
 
 #include "ChargedProjectile.h"
+#include "RCBlueprintOverrides.h"
+#include "RCChargeProjectileTable.h"
 #include "RCCharacterMovementComponent.h"
+#include "RCCharacterPoolSubsystem.h"
+#include "RCCharacterStats.h"
+#include "RCCombatReplication.h"
+#include "RCCombatTickSubsystem.h"
+#include "RCCombatVFXSubsystem.h"
+#include "RCCombatVFXTable.h"
 #include "RCFollowCameraComponent.h"
+#include "RCGameplayTimers.h"
+#include "RCInputBuffer.h"
+#include "RCInputRecording.h"
+#include "RCLagCompensationSubsystem.h"
+#include "RCProjectileManagerSubsystem.h"
+#include "RCProjectilePoolSubsystem.h"
+#include "RCShieldComponent.h"
+#include "RCSignificanceSubsystem.h"
 #include "Components/InputComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "GameFramework/Controller.h"
+#include "GameFramework/GameStateBase.h"
 #include "GameFramework/PlayerController.h"
 #include "EnhancedInputComponent.h"
 #include "EnhancedInputSubsystems.h"
+#include "Engine/AssetManager.h"
 #include "Engine/LocalPlayer.h"
 #include "Engine/World.h"
 #include "InputActionValue.h"
+#include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
+#include "RCDamageBatchSubsystem.h"
+#include "RCDamageGate.h"
 #include "RCDeathManagerComponent.h"
 #include "RCVitalityManagerComponent.h"
 #include "RCVitalityObject.h"
 #include "Components/CapsuleComponent.h"
 
+/** Call a BlueprintNativeEvent handler, skipping the script thunk when no Blueprint overrides it. */
+#define RC_DISPATCH_HANDLER(Name, ...) \
+	(BlueprintOverrides.IsOverridden(ERCNativeHandler::Name) ? Name(__VA_ARGS__) : Name##_Implementation(__VA_ARGS__))
+
+/** Bind an input action straight to a handler's _Implementation when no Blueprint overrides it. */
+#define RC_BIND_HANDLER(InputComponent, Action, TriggerEvent, Name) \
+	(BlueprintOverrides.IsOverridden(ERCNativeHandler::Name) \
+		 ? (InputComponent)->BindAction(Action, TriggerEvent, this, &ARCCharacter::Name) \
+		 : (InputComponent)->BindAction(Action, TriggerEvent, this, &ARCCharacter::Name##_Implementation))
 
 ARCCharacter::ARCCharacter(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer.SetDefaultSubobjectClass<URCCharacterMovementComponent>(
@@ -40,59 +71,207 @@ ARCCharacter::ARCCharacter(const FObjectInitializer& ObjectInitializer)
 	// Create the Melee attack component
 	MeleeAttackComponent = CreateDefaultSubobject<URCMeleeAttackComponent>(TEXT("RCMeleeAttack"));
 
+	// Create the equippable visuals once, meshes and sockets are applied in OnConstruction
+	RangedEquippable = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("RangedEquippable"));
+	RangedEquippable->SetupAttachment(GetMesh());
+	RangedEquippable->SetRelativeRotation(FRotator(-90, -90, 0));
+	RangedEquippable->SetVisibility(false);
+
+	MeleeEquippable = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("MeleeEquippable"));
+	MeleeEquippable->SetupAttachment(GetMesh());
+	MeleeEquippable->SetRelativeRotation(FRotator(90, -90, 0));
+	MeleeEquippable->SetRelativeScale3D(FVector(1.f, 1.1f, 1.f));
+	MeleeEquippable->SetVisibility(false);
+
+	ShieldEquippable = CreateDefaultSubobject<URCShieldComponent>(TEXT("ShieldEquippable"));
+	ShieldEquippable->SetupAttachment(GetMesh());
+
 	// Disable controller rotation									
 	bUseControllerRotationPitch = false;
 	bUseControllerRotationYaw = false;
 	bUseControllerRotationRoll = false;
+
+	// Tick only runs while inputs are buffered or a gameplay deadline is pending
+	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = false;
 }
 
 void ARCCharacter::Tick(float DeltaTime)
 {
+	RC_CHARACTER_SCOPE(Tick);
+
 	Super::Tick(DeltaTime);
 
-	// Shield buffer execution
-	if (bWantsToShield)
+	// Nothing left to wait on, stop ticking until something is buffered or scheduled again
+	if (!TickCombat(FRCGameplayTimers::GetFrame(GetWorld())))
 	{
-		const float CurrentTime = GetWorld()->GetTimeSeconds();
-		if ((LastEquipTime + EquipDelay) < CurrentTime)
-		{
-			ActivateShield();
-		}
+		SetActorTickEnabled(false);
 	}
-	// Ranged attack buffer execution
-	if (bWantsToShoot)
+}
+
+bool ARCCharacter::TickCombat(int32 CurrentFrame)
+{
+	HandleExpiredDeadlines(Timers.PopExpired(CurrentFrame));
+
+	// Buffered inputs are resolved once the equip delay has elapsed, before expiry since they are judged by
+	// when the delay elapsed rather than by this tick
+	if (GetEquipReadyFrame() < CurrentFrame)
 	{
-		const float CurrentTime = GetWorld()->GetTimeSeconds();
-		if ((LastEquipTime + EquipDelay) < CurrentTime)
-		{
-			RangedAttack();
-		}
+		ResolveBufferedInput(CurrentFrame);
 	}
-	// Charged range attack buffer execution
-	if (bWantsToReleaseShoot)
+	INC_DWORD_STAT_BY(STAT_RCCharacter_BufferedInputsExpired, InputBuffer.RemoveExpired(CurrentFrame));
+
+	PushCombatTickState();
+	return !InputBuffer.IsEmpty() || Timers.HasPendingDeadlines();
+}
+
+void ARCCharacter::GetCombatTickState(FRCCombatTickState& OutState) const
+{
+	OutState.EquipReadyFrame = GetEquipReadyFrame();
+	OutState.NextDeadlineFrame = Timers.GetNextDeadlineFrame();
+	OutState.NextInputExpireFrame = InputBuffer.GetNextExpireFrame();
+	OutState.bHasBufferedInput = !InputBuffer.IsEmpty();
+	OutState.bHasPendingWork = OutState.bHasBufferedInput || Timers.HasPendingDeadlines();
+}
+
+void ARCCharacter::PushCombatTickState()
+{
+	if (CombatTickSlot == INDEX_NONE) return;
+
+	if (URCCombatTickSubsystem* CombatTick = GetWorld()->GetSubsystem<URCCombatTickSubsystem>())
 	{
-		const float CurrentTime = GetWorld()->GetTimeSeconds();
-		if ((LastEquipTime + EquipDelay) < CurrentTime)
-		{
-			ReleaseRangedAttack();
-		}
+		FRCCombatTickState State;
+		GetCombatTickState(State);
+		CombatTick->SetTickState(CombatTickSlot, State);
+	}
+}
+
+void ARCCharacter::RequestCombatTick()
+{
+	if (CombatTickSlot != INDEX_NONE)
+	{
+		PushCombatTickState();
+		return;
 	}
-	// Melee attack buffer execution
-	if (bWantsToMelee)
+	SetActorTickEnabled(true);
+}
+
+void ARCCharacter::SetRangedAttackChargeStartTime(float ChargeStartTime)
+{
+	RangedAttackChargeStartTime = ChargeStartTime;
+	UpdateCombatState();
+}
+
+void ARCCharacter::SetGameplayDeadline(ERCGameplayDeadline Deadline, float DelaySeconds)
+{
+	const int32 CurrentFrame = FRCGameplayTimers::GetFrame(GetWorld());
+	Timers.SetDeadline(Deadline, CurrentFrame + FRCGameplayTimers::SecondsToFrames(DelaySeconds));
+	RequestCombatTick();
+}
+
+void ARCCharacter::HandleExpiredDeadlines(uint8 ExpiredMask)
+{
+	if (ExpiredMask & FRCGameplayTimers::ToBit(ERCGameplayDeadline::IFrames))
+	{
+		EndInvincibility();
+	}
+	if (ExpiredMask & FRCGameplayTimers::ToBit(ERCGameplayDeadline::Coyote))
 	{
-		const float CurrentTime = GetWorld()->GetTimeSeconds();
-		if ((LastEquipTime + EquipDelay) < CurrentTime)
+		// Coyote time ran out without a jump, the fall now counts as the first jump
+		if (RCCharacterMovementComponent->IsFalling() && JumpCurrentCount <= 0)
 		{
-			MeleeAttack();
+			JumpCurrentCount++;
+			bInCoyoteTime = false;
 		}
 	}
-	// Charged melee attack buffer execution
-	else if (bWantsToReleaseMelee)
+	if (ExpiredMask & FRCGameplayTimers::ToBit(ERCGameplayDeadline::DeathMontage))
+	{
+		OnDeathMontageFinished();
+	}
+}
+
+FRCInputEventTime ARCCharacter::GetInputEventTime() const
+{
+	// Live input takes effect on the frame it is handled
+	if (CurrentInputEvent.IsSet())
 	{
-		const float CurrentTime = GetWorld()->GetTimeSeconds();
-		if ((LastEquipTime + EquipDelay) < CurrentTime)
+		return CurrentInputEvent;
+	}
+	return FRCInputEventTime{GetWorld()->GetTimeSeconds(), FRCGameplayTimers::GetFrame(GetWorld())};
+}
+
+int32 ARCCharacter::GetEquipReadyFrame() const
+{
+	return Timers.LastEquipFrame + FRCGameplayTimers::SecondsToFrames(EquipDelay);
+}
+
+int32 ARCCharacter::GetMeleeReadyFrame() const
+{
+	return Timers.LastMeleeAttackFrame + FRCGameplayTimers::SecondsToFrames(MeleeAttackDelay);
+}
+
+void ARCCharacter::BufferInput(ERCBufferedInput Action)
+{
+	// Releases never expire so a held charge is always resolved.
+	// Stamped with the current time, so an action that buffers itself again while resolving moves forward.
+	const bool bIsRelease = Action == ERCBufferedInput::ReleaseShoot || Action == ERCBufferedInput::ReleaseMelee;
+	InputBuffer.Push(Action, FRCGameplayTimers::GetFrame(GetWorld()), GetWorld()->GetTimeSeconds(),
+	                 bIsRelease ? MAX_int32 : FRCGameplayTimers::SecondsToFrames(InputBufferLifetime));
+	RequestCombatTick();
+}
+
+void ARCCharacter::ResolveBufferedInput(int32 CurrentFrame)
+{
+	// A buffered melee press takes precedence over a buffered melee release
+	const bool bMeleePending = InputBuffer.Contains(ERCBufferedInput::Melee);
+
+	for (int32 Index = 0; Index < FRCInputBuffer::Capacity; ++Index)
+	{
+		const ERCBufferedInput Action = static_cast<ERCBufferedInput>(Index);
+		if (!InputBuffer.Contains(Action)) continue;
+		if (Action == ERCBufferedInput::ReleaseMelee && bMeleePending) continue;
+
+		// A resolved action may have started another equip swap, keep the rest buffered until it finishes
+		if (!(GetEquipReadyFrame() < CurrentFrame)) break;
+
+		// The action takes effect when the equip delay elapsed, not on whichever tick noticed
+		const FRCBufferedInput Entry = InputBuffer.Get(Action);
+		const int32 GateOpenFrame = GetEquipReadyFrame() + 1;
+		FRCInputEventTime EventTime{FRCGameplayTimers::FrameToTime(GateOpenFrame), GateOpenFrame};
+		if (Entry.BufferedFrame >= GateOpenFrame)
 		{
-			ReleaseMeleeAttack();
+			EventTime = FRCInputEventTime{Entry.BufferedTime, Entry.BufferedFrame};
+		}
+
+		// Handlers re-buffer themselves if they still can't run
+		InputBuffer.Remove(Action);
+		if (Entry.ExpireFrame < EventTime.Frame)
+		{
+			INC_DWORD_STAT(STAT_RCCharacter_BufferedInputsExpired);
+			continue;
+		}
+		INC_DWORD_STAT(STAT_RCCharacter_BufferedInputsConsumed);
+
+		TGuardValue<FRCInputEventTime> EventTimeGuard(CurrentInputEvent, EventTime);
+		switch (Action)
+		{
+		case ERCBufferedInput::Shield:
+			RC_DISPATCH_HANDLER(ActivateShield);
+			break;
+		case ERCBufferedInput::Shoot:
+			RC_DISPATCH_HANDLER(RangedAttack);
+			break;
+		case ERCBufferedInput::ReleaseShoot:
+			RC_DISPATCH_HANDLER(ReleaseRangedAttack);
+			break;
+		case ERCBufferedInput::Melee:
+			RC_DISPATCH_HANDLER(MeleeAttack);
+			break;
+		case ERCBufferedInput::ReleaseMelee:
+			RC_DISPATCH_HANDLER(ReleaseMeleeAttack);
+			break;
+		default:
+			break;
 		}
 	}
 }
@@ -107,15 +286,158 @@ void ARCCharacter::OnConstruction(const FTransform& Transform)
 		GetMesh()->HideBoneByName(BoneToRemove, PBO_None);
 	}
 
+	// Apply whatever is already loaded, the rest is applied once the combat assets arrive
 	SetupEquippable(EEquippable::EE_Shield);
 	SetupEquippable(EEquippable::EE_Melee);
 	SetupEquippable(EEquippable::EE_Ranged);
+	RequestCombatAssets();
+
+	ChargeProjectileTable.Build(RangedProjectiles, this);
 }
 
-void ARCCharacter::BeginPlay()
+void ARCCharacter::PostInitializeComponents()
+{
+	Super::PostInitializeComponents();
+
+	// Before possession binds input, so bindings can already skip handlers Blueprint doesn't override
+	InitializeBlueprintOverrides();
+
+	// Streamed-in and cooked level characters don't run construction, start loading as the level is added
+	RequestCombatAssets();
+}
+
+void ARCCharacter::InitializeBlueprintOverrides()
+{
+	// Indexed by ERCNativeHandler
+	static const FName HandlerNames[] = {
+		GET_FUNCTION_NAME_CHECKED(ARCCharacter, JumpOrDrop),
+		GET_FUNCTION_NAME_CHECKED(ARCCharacter, ReleaseJump),
+		GET_FUNCTION_NAME_CHECKED(ARCCharacter, CrouchDrop),
+		GET_FUNCTION_NAME_CHECKED(ARCCharacter, StopCrouchDrop),
+		GET_FUNCTION_NAME_CHECKED(ARCCharacter, Dash),
+		GET_FUNCTION_NAME_CHECKED(ARCCharacter, RangedAttack),
+		GET_FUNCTION_NAME_CHECKED(ARCCharacter, ReleaseRangedAttack),
+		GET_FUNCTION_NAME_CHECKED(ARCCharacter, MeleeAttack),
+		GET_FUNCTION_NAME_CHECKED(ARCCharacter, ReleaseMeleeAttack),
+		GET_FUNCTION_NAME_CHECKED(ARCCharacter, ActivateShield),
+		GET_FUNCTION_NAME_CHECKED(ARCCharacter, ReleaseShield),
+		GET_FUNCTION_NAME_CHECKED(ARCCharacter, ActivateHeal),
+		GET_FUNCTION_NAME_CHECKED(ARCCharacter, ReleaseHeal),
+		GET_FUNCTION_NAME_CHECKED(ARCCharacter, PauseGame),
+		GET_FUNCTION_NAME_CHECKED(ARCCharacter, OpenMenu),
+		GET_FUNCTION_NAME_CHECKED(ARCCharacter, SwapEquippable),
+	};
+	static_assert(UE_ARRAY_COUNT(HandlerNames) == static_cast<int32>(ERCNativeHandler::Count));
+
+	BlueprintOverrides.Initialize(GetClass(), ARCCharacter::StaticClass(), HandlerNames);
+}
+
+void ARCCharacter::GetCombatAssetPaths(TArray<FSoftObjectPath>& OutAssetPaths) const
+{
+	const FSoftObjectPath AssetPaths[] = {
+		RangedEquippableMesh.ToSoftObjectPath(),
+		MeleeEquippableMesh.ToSoftObjectPath(),
+		ShieldEquippableMesh.ToSoftObjectPath(),
+		DeathMontage.ToSoftObjectPath(),
+	};
+	for (const FSoftObjectPath& AssetPath : AssetPaths)
+	{
+		if (AssetPath.IsValid())
+		{
+			OutAssetPaths.AddUnique(AssetPath);
+		}
+	}
+}
+
+TSharedPtr<FStreamableHandle> ARCCharacter::PreloadCombatAssets(TSubclassOf<ARCCharacter> CharacterClass,
+                                                                FStreamableDelegate OnLoaded)
+{
+	TArray<FSoftObjectPath> AssetPaths;
+	if (CharacterClass)
+	{
+		CharacterClass->GetDefaultObject<ARCCharacter>()->GetCombatAssetPaths(AssetPaths);
+	}
+	return LoadCombatAssets(MoveTemp(AssetPaths), MoveTemp(OnLoaded));
+}
+
+TSharedPtr<FStreamableHandle> ARCCharacter::LoadCombatAssets(TArray<FSoftObjectPath> AssetPaths,
+                                                             FStreamableDelegate OnLoaded)
+{
+	if (AssetPaths.IsEmpty())
+	{
+		OnLoaded.ExecuteIfBound();
+		return nullptr;
+	}
+	return UAssetManager::GetStreamableManager().RequestAsyncLoad(MoveTemp(AssetPaths), MoveTemp(OnLoaded),
+	                                                              FStreamableManager::AsyncLoadHighPriority);
+}
+
+void ARCCharacter::RequestCombatAssets()
+{
+	TArray<FSoftObjectPath> AssetPaths;
+	GetCombatAssetPaths(AssetPaths);
+
+	// Construction reruns on every edit, only request again when a soft reference actually changed
+	if (CombatAssetsHandle.IsValid())
+	{
+		TArray<FSoftObjectPath> RequestedPaths;
+		CombatAssetsHandle->GetRequestedAssets(RequestedPaths);
+		if (RequestedPaths == AssetPaths) return;
+
+		CombatAssetsHandle->ReleaseHandle();
+		CombatAssetsHandle.Reset();
+	}
+
+	// The handle keeps this character's assets resident for as long as it lives
+	CombatAssetsHandle = LoadCombatAssets(MoveTemp(AssetPaths),
+	                                      FStreamableDelegate::CreateUObject(this, &ARCCharacter::OnCombatAssetsLoaded));
+}
+
+void ARCCharacter::OnCombatAssetsLoaded()
 {
-	ShieldEquippableObject->SetVisibility(false);
+	SetupEquippable(EEquippable::EE_Shield);
+	SetupEquippable(EEquippable::EE_Melee);
+	SetupEquippable(EEquippable::EE_Ranged);
+}
 
+void ARCCharacter::PostLoad()
+{
+	Super::PostLoad();
+
+#if WITH_EDITORONLY_DATA
+	// The shield used to be an actor spawned from ShieldEquippableClass, carry its mesh over to the component
+	if (ShieldEquippableClass_DEPRECATED)
+	{
+		const AActor* ShieldDefaults = ShieldEquippableClass_DEPRECATED->GetDefaultObject<AActor>();
+		const UStaticMeshComponent* ShieldMesh = ShieldDefaults->FindComponentByClass<UStaticMeshComponent>();
+		if (ShieldEquippableMesh.IsNull() && ShieldMesh && ShieldMesh->GetStaticMesh())
+		{
+			ShieldEquippableMesh = ShieldMesh->GetStaticMesh();
+		}
+		else if (ShieldEquippableMesh.IsNull())
+		{
+			UE_LOG(LogTemp, Warning, TEXT("%s: no mesh found on the old shield class %s, set ShieldEquippableMesh."),
+			       *GetPathName(), *GetNameSafe(ShieldEquippableClass_DEPRECATED));
+		}
+		ShieldEquippableClass_DEPRECATED = nullptr;
+	}
+#endif
+}
+
+#if WITH_EDITOR
+void ARCCharacter::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	if (PropertyChangedEvent.GetMemberPropertyName() == GET_MEMBER_NAME_CHECKED(ARCCharacter, RangedProjectiles))
+	{
+		ChargeProjectileTable.Build(RangedProjectiles, this);
+	}
+}
+#endif
+
+void ARCCharacter::BeginPlay()
+{
 	//Add Input Mapping Context
 	if (APlayerController* PlayerController = Cast<APlayerController>(Controller))
 	{
@@ -135,102 +457,195 @@ void ARCCharacter::BeginPlay()
 		DeathManager->OnIsDead.AddDynamic(this, &ARCCharacter::OnIsDead);
 	}
 
-	// Setup range arm as default
-	SwapEquippable(EEquippable::EE_Ranged);
+	// Look up the health vitality once instead of on every hit
+	ResolveHealthVitality();
+
+	// Level-placed characters in cooked builds don't run construction
+	if (!ChargeProjectileTable.IsBuilt())
+	{
+		ChargeProjectileTable.Build(RangedProjectiles, this);
+	}
+
+	// Hand combat timing to the batched tick instead of ticking this actor
+	if (bUseBatchedCombatTick)
+	{
+		if (URCCombatTickSubsystem* CombatTick = GetWorld()->GetSubsystem<URCCombatTickSubsystem>())
+		{
+			CombatTickSlot = CombatTick->Register(this);
+			PushCombatTickState();
+		}
+	}
+
+	// Keep a capsule history for rewinding hits to what remote clients saw
+	const ENetMode NetMode = GetNetMode();
+	if (HasAuthority() && (NetMode == NM_DedicatedServer || NetMode == NM_ListenServer))
+	{
+		if (URCLagCompensationSubsystem* LagCompensation = GetWorld()->GetSubsystem<URCLagCompensationSubsystem>())
+		{
+			LagCompensationSlot = LagCompensation->Register(this);
+		}
+	}
+
+	// Throttle animation, movement and camera updates by how much the character matters to the players
+	if (bUseSignificance)
+	{
+		if (URCSignificanceSubsystem* Significance = GetWorld()->GetSubsystem<URCSignificanceSubsystem>())
+		{
+			DefaultVisibilityBasedAnimTickOption = GetMesh()->VisibilityBasedAnimTickOption;
+			Significance->Register(this);
+		}
+	}
+
+	// Have projectiles ready before the first shot
+	if (URCProjectilePoolSubsystem* ProjectilePool = GetWorld()->GetSubsystem<URCProjectilePoolSubsystem>())
+	{
+		for (const FChargedProjectile& Entry : RangedProjectiles)
+		{
+			ProjectilePool->Prewarm(Entry.ProjectileClass, ProjectilePoolPrewarmCount, this, this);
+		}
+	}
+
+	// Show whatever starts equipped, then setup range arm as default
+	ApplyEquippableVisibility(GetEquippableMask(CurrentEquippable));
+	RC_DISPATCH_HANDLER(SwapEquippable, EEquippable::EE_Ranged, false);
 
 	Super::BeginPlay();
 }
 
-void ARCCharacter::SetupEquippable(EEquippable equip)
+void ARCCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	if (equip == EEquippable::EE_Ranged)
+	if (CombatTickSlot != INDEX_NONE)
 	{
-		if (RangedEquippableMesh)
+		if (URCCombatTickSubsystem* CombatTick = GetWorld()->GetSubsystem<URCCombatTickSubsystem>())
 		{
-			RangedEquippable = NewObject<UStaticMeshComponent>(this, TEXT("RangedEquippable"));
-			RangedEquippable->RegisterComponent();
-			RangedEquippable->AttachToComponent(GetMesh(), FAttachmentTransformRules::SnapToTargetIncludingScale,
-			                                    RangedAttachName);
-			RangedEquippable->SetStaticMesh(RangedEquippableMesh);
-			RangedEquippable->SetRelativeTransform(FTransform(FRotator(-90, -90, 0)));
-			AddInstanceComponent(RangedEquippable);
+			CombatTick->Unregister(CombatTickSlot);
 		}
+		CombatTickSlot = INDEX_NONE;
 	}
-	if (equip == EEquippable::EE_Melee)
+
+	if (LagCompensationSlot != INDEX_NONE)
 	{
-		if (MeleeEquippableMesh)
+		if (URCLagCompensationSubsystem* LagCompensation = GetWorld()->GetSubsystem<URCLagCompensationSubsystem>())
 		{
-			RangedEquippable = NewObject<UStaticMeshComponent>(this, TEXT("RangedEquippable"));
-			RangedEquippable->RegisterComponent();
-			RangedEquippable->AttachToComponent(GetMesh(), FAttachmentTransformRules::SnapToTargetIncludingScale,
-			                                    RangedAttachName);
-			RangedEquippable->SetStaticMesh(RangedEquippableMesh);
-			RangedEquippable->SetRelativeTransform(FTransform(FRotator(-90, -90, 0)));
-			AddInstanceComponent(RangedEquippable);
+			LagCompensation->Unregister(LagCompensationSlot);
 		}
+		LagCompensationSlot = INDEX_NONE;
 	}
-	if (equip == EEquippable::EE_Melee)
+
+	if (bUseSignificance)
 	{
-		if (MeleeEquippableMesh)
+		if (URCSignificanceSubsystem* Significance = GetWorld()->GetSubsystem<URCSignificanceSubsystem>())
 		{
-			MeleeEquippable = NewObject<UStaticMeshComponent>(this, TEXT("MeleeEquippable"));
-			MeleeEquippable->RegisterComponent();
-			MeleeEquippable->AttachToComponent(GetMesh(), FAttachmentTransformRules::SnapToTargetIncludingScale,
-			                                   MeleeAttachName);
-			MeleeEquippable->SetStaticMesh(MeleeEquippableMesh);
-			MeleeEquippable->SetRelativeTransform(FTransform(FRotator(90, -90, 0)));
-			MeleeEquippable->SetRelativeScale3D(FVector(1.f,1.1f,1.f));
-			AddInstanceComponent(MeleeEquippable);
+			Significance->Unregister(this);
 		}
 	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void ARCCharacter::SetSignificanceTier(ERCSignificanceTier NewTier)
+{
+	if (NewTier == SignificanceTier) return;
+	SignificanceTier = NewTier;
+
+	// The actor tick is left alone, it only runs while input or a deadline is pending and resolves both by frame
+	const FRCSignificanceTierSettings& Settings = SignificanceSettings.Get(NewTier);
+
+	USkeletalMeshComponent* CharacterMesh = GetMesh();
+	CharacterMesh->bEnableUpdateRateOptimizations = Settings.bAnimUpdateRateOptimizations;
+	CharacterMesh->SetComponentTickInterval(Settings.MeshTickInterval);
+
+	// Nothing renders on a dedicated server, skipping the pose there would leave melee sockets stale
+	if (GetNetMode() != NM_DedicatedServer)
+	{
+		CharacterMesh->VisibilityBasedAnimTickOption = Settings.bOnlyTickMontagesWhenNotRendered
+			                                               ? EVisibilityBasedAnimTickOption::OnlyTickMontagesWhenNotRendered
+			                                               : DefaultVisibilityBasedAnimTickOption;
+	}
+
+	// Player movement is predicted and corrected from saved moves, it keeps running every frame
+	if (!IsPlayerControlled())
+	{
+		RCCharacterMovementComponent->SetComponentTickInterval(Settings.MovementTickInterval);
+	}
+
+	// Only a player's view target is ever looked through
+	FollowCamera->SetActive(NewTier == ERCSignificanceTier::Viewed);
+}
+
+void ARCCharacter::SetupEquippable(EEquippable equip)
+{
+	RC_CHARACTER_SCOPE(SetupEquippable);
+
+	if (equip == EEquippable::EE_Ranged)
+	{
+		RangedEquippable->SetStaticMesh(RangedEquippableMesh.Get());
+		RangedEquippable->AttachToComponent(GetMesh(), FAttachmentTransformRules::KeepRelativeTransform,
+		                                    RangedAttachName);
+	}
+	if (equip == EEquippable::EE_Melee)
+	{
+		MeleeEquippable->SetStaticMesh(MeleeEquippableMesh.Get());
+		MeleeEquippable->AttachToComponent(GetMesh(), FAttachmentTransformRules::KeepRelativeTransform,
+		                                   MeleeAttachName);
+	}
 	if (equip == EEquippable::EE_Shield)
 	{
-		if (ShieldEquippableClass)
-		{
-			// SpawnParams to ensure it belongs to this actor
-			FActorSpawnParameters SpawnParams;
-			SpawnParams.Owner = this;
-			SpawnParams.Instigator = GetInstigator();
-			SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		ShieldEquippable->SetStaticMesh(ShieldEquippableMesh.Get());
+		ShieldEquippable->AttachToComponent(GetMesh(), FAttachmentTransformRules::KeepRelativeTransform,
+		                                    ShieldAttachName);
+	}
 
-			// Spawn the shield actor
-			ShieldEquippableObject = GetWorld()->SpawnActor<ARCPlayerShield>(ShieldEquippableClass, SpawnParams);
+	InvalidateIgnoreSelfParams();
+}
 
-			if (ShieldEquippableObject)
-			{
-				// Attach to mesh socket or bone
-				ShieldEquippableObject->AttachToComponent(
-					GetMesh(),
-					FAttachmentTransformRules::SnapToTargetIncludingScale,
-					ShieldAttachName
-				);
-			}
-		}
+uint8 ARCCharacter::GetEquippableMask(EEquippable Equippable)
+{
+	switch (Equippable)
+	{
+	case EEquippable::EE_Ranged: return 1 << 0;
+	case EEquippable::EE_Melee: return 1 << 1;
+	case EEquippable::EE_Shield: return 1 << 2;
+	default: return 0;
 	}
 }
 
-TSubclassOf<ARCProjectile> ARCCharacter::GetProjectileForCharge(int32 ChargeTime)
+void ARCCharacter::ApplyEquippableVisibility(uint8 VisibleMask)
 {
-	for (int32 i = ChargeTime; i >= 0; --i)
+	// Only equippables whose visibility actually changes are touched
+	const uint8 ChangedMask = EquippableVisibilityMask ^ VisibleMask;
+	EquippableVisibilityMask = VisibleMask;
+	if (ChangedMask == 0) return;
+
+	if (ChangedMask & GetEquippableMask(EEquippable::EE_Ranged))
 	{
-		for (const FChargedProjectile& Entry : RangedProjectiles)
-		{
-			if (Entry.ChargeTimeInSeconds == i)
-			{
-				return Entry.ProjectileClass;
-			}
-		}
+		RangedEquippable->SetVisibility((VisibleMask & GetEquippableMask(EEquippable::EE_Ranged)) != 0);
+	}
+	if (ChangedMask & GetEquippableMask(EEquippable::EE_Melee))
+	{
+		MeleeEquippable->SetVisibility((VisibleMask & GetEquippableMask(EEquippable::EE_Melee)) != 0);
 	}
+	if (ChangedMask & GetEquippableMask(EEquippable::EE_Shield))
+	{
+		ShieldEquippable->SetVisibility((VisibleMask & GetEquippableMask(EEquippable::EE_Shield)) != 0);
+	}
+}
 
-	return nullptr;
+TSubclassOf<ARCProjectile> ARCCharacter::GetProjectileForCharge(float ChargeTime) const
+{
+	return ChargeProjectileTable.Find(ChargeTime);
 }
 
 void ARCCharacter::OnIsDead(URCDeathManagerComponent* DeadManager)
 {
+	DamageGate.SetIsDead(true);
+
 	// If we have a death montage for the character, play it. This is dynamic can can be situationally changed.
-	if (DeathMontage)
+	// It is part of the requested combat assets, a character that dies before they arrive skips straight to the end.
+	UAnimMontage* Montage = DeathMontage.Get();
+	if (Montage)
 	{
-		PlayAnimMontage(DeathMontage, DeathMontagePlayRate);
+		PlayAnimMontage(Montage, DeathMontagePlayRate);
 	}
 
 	// Stop all player input and movement to allow death to play out
@@ -238,80 +653,278 @@ void ARCCharacter::OnIsDead(URCDeathManagerComponent* DeadManager)
 	GetCharacterMovement()->StopMovementImmediately();
 	GetCharacterMovement()->DisableMovement();
 	GetRCCharacterMovement()->StopActiveMovement();
+	SetIsShielding(false);
 
-	// Set a timer based on the animation time to eventually destroy the player model.
-	GetWorldTimerManager().SetTimer(DeathMontageTimerHandle, this, &ARCCharacter::OnDeathMontageFinished,
-	                                DeathMontage->GetPlayLength() * (1 / DeathMontagePlayRate) -
-	                                AdjustedDeathMontageEndTimeReduction, false);
+	// Set a deadline based on the animation time to eventually destroy the player model.
+	float DeathSeconds = 0.f;
+	if (Montage)
+	{
+		DeathSeconds = Montage->GetPlayLength() * (1 / DeathMontagePlayRate) - AdjustedDeathMontageEndTimeReduction;
+	}
+	SetGameplayDeadline(ERCGameplayDeadline::DeathMontage, DeathSeconds);
 }
 
 void ARCCharacter::OnDeathMontageFinished()
 {
+	// Hide the loadout through the mask first so it stays in sync with the propagated mesh visibility
+	ApplyEquippableVisibility(0);
 	GetMesh()->SetVisibility(false, true);
-	
-	// Destroy any outstanding models
-	// This could potentially be handled better
-	if (MeleeEquippable != nullptr)
+
+	DeathManager->OnDeathMontageFinished.Broadcast();
+
+	// Go dormant instead of waiting to be destroyed, unless a listener already did. Only characters acquired from
+	// the pool go back to it
+	if (bReturnToPoolOnDeath && !IsActorBeingDestroyed())
 	{
-		MeleeEquippable->DestroyComponent();
-		MeleeEquippable = nullptr;
+		URCCharacterPoolSubsystem* CharacterPool = GetWorld()->GetSubsystem<URCCharacterPoolSubsystem>();
+		if (CharacterPool && CharacterPool->IsAcquired(this))
+		{
+			CharacterPool->Release(this);
+		}
 	}
+}
+
+void ARCCharacter::ClearCombatState()
+{
+	Timers.Reset();
+	InputBuffer.Reset();
+	PendingDamageEvents.Reset();
+
+	// The combat tick slot stays registered, it just has nothing due any more
+	SetActorTickEnabled(false);
+	PushCombatTickState();
+}
+
+void ARCCharacter::ResetForReuse()
+{
+	// Combat timing, buffered input and queued damage
+	ClearCombatState();
+	DamageGate.Reset();
+	SetRangedAttackChargeStartTime(MAX_FLT);
+	bIsHealing = false;
+	SetCanBeDamaged_Implementation(true);
+	ResetVitality();
+
+	// Jump and coyote state
+	ResetJumpState();
+	JumpCurrentCount = 0;
+	bInCoyoteTime = false;
+
+	// Movement
+	StopAnimMontage();
+	GetCharacterMovement()->StopMovementImmediately();
+	GetCharacterMovement()->SetDefaultMovementMode();
+	RCCharacterMovementComponent->IsShooting = false;
+	RCCharacterMovementComponent->IsMeleeing = false;
+	RCCharacterMovementComponent->SetFacingRight(GetActorForwardVector().X > 0);
+	SetIsShielding(false);
+
+	// Pick up soft references changed while dormant, the swap below applies whatever is loaded
+	RequestCombatAssets();
+
+	// Showing the mesh propagates to the whole loadout, so sync the mask before hiding all but the ranged arm
+	GetMesh()->SetVisibility(true, true);
+	EquippableVisibilityMask = GetEquippableMask(EEquippable::EE_Ranged) | GetEquippableMask(EEquippable::EE_Melee) |
+		GetEquippableMask(EEquippable::EE_Shield);
+	CurrentEquippable = EEquippable::EE_None;
+	LastEquippable = EEquippable::EE_Ranged;
+	RC_DISPATCH_HANDLER(SwapEquippable, EEquippable::EE_Ranged, true);
+
+	// Input is left to possession, PossessedBy and SetupPlayerInputComponent hook up whoever controls it next
+}
+
+void ARCCharacter::ResetVitality_Implementation()
+{
+	// Revive first so the refill isn't treated as damage to a dead character
+	DeathManager->SetIsDead(false, nullptr);
 
-	if (RangedEquippable != nullptr)
+	if (URCVitalityObject* HealthVitality = GetHealthVitality())
 	{
-		RangedEquippable->DestroyComponent();
-		RangedEquippable = nullptr;
+		HealthVitality->SetCurrentVitality(HealthVitality->GetMaxVitality());
+		OnHealthChanged.Broadcast(HealthVitality->GetCurrentVitality(), HealthVitality->GetNormalizedVitality());
 	}
+}
+
+bool ARCCharacter::ApplyDamageEvent_Implementation(FRCDamageEvent& damageEvent)
+{
+	RC_CHARACTER_SCOPE(ApplyDamageEvent);
 
-	if (AActor* ShieldActor = Cast<AActor>(ShieldEquippableObject))
+	// Discard damage that can't land before it reaches the vitality manager
+	if (IsDamageEventFiltered(damageEvent))
 	{
-		ShieldActor->Destroy();
-		ShieldEquippableObject = nullptr;
+		INC_DWORD_STAT(STAT_RCCharacter_DamageEventsFiltered);
+		return false;
 	}
-	else if (ShieldEquippableObject != nullptr)
+
+	// Batched damage is queued and resolved once at the end of the frame
+	if (bBatchDamageEvents)
 	{
-		ShieldEquippableObject = nullptr;
+		if (URCDamageBatchSubsystem* DamageBatch = GetWorld()->GetSubsystem<URCDamageBatchSubsystem>())
+		{
+			if (PendingDamageEvents.IsEmpty())
+			{
+				DamageBatch->QueueCharacter(this);
+			}
+			PendingDamageEvents.Add(damageEvent);
+			return IRCDamageableInterface::ApplyDamageEvent_Implementation(damageEvent);
+		}
 	}
 
-	DeathManager->OnDeathMontageFinished.Broadcast();
+	ResolveDamageEvents(MakeArrayView(&damageEvent, 1));
+
+	return IRCDamageableInterface::ApplyDamageEvent_Implementation(damageEvent);
 }
 
-bool ARCCharacter::ApplyDamageEvent_Implementation(FRCDamageEvent& damageEvent)
+bool ARCCharacter::IsDamageEventFiltered(const FRCDamageEvent& damageEvent)
+{
+	if (!bCanBeDamaged) return true;	// I-frames
+	if (DamageGate.IsDead()) return true;
+
+	// Continuous hazards and sweeps re-hit every frame, only let each source through once per cooldown
+	return SourceRehitCooldown > 0.f &&
+		DamageGate.IsSourceOnCooldown(damageEvent.Source, FRCGameplayTimers::GetFrame(GetWorld()),
+		                              FRCGameplayTimers::SecondsToFrames(SourceRehitCooldown));
+}
+
+void ARCCharacter::ResolvePendingDamage()
 {
-	VitalityManager->HandleApplyDamageEvent(damageEvent);
+	RC_CHARACTER_SCOPE(ApplyDamageEvent);
+
+	if (PendingDamageEvents.IsEmpty()) return;
 
-	TArray<URCVitalityObject*> healthVitality;
-	VitalityManager->GetVitalityObjectsByTag(HealthTag, healthVitality);
-	if (healthVitality.IsValidIndex(0) && !healthVitality.IsEmpty())
+	ResolveDamageEvents(PendingDamageEvents);
+	PendingDamageEvents.Reset();
+}
+
+void ARCCharacter::ResolveDamageEvents(TArrayView<FRCDamageEvent> DamageEvents)
+{
+	const URCVitalityObject* HealthVitality = GetHealthVitality();
+	const FRCDamageEvent* KillingEvent = nullptr;
+	FRCDamageEvent* LastAppliedEvent = nullptr;
+
+	for (FRCDamageEvent& DamageEvent : DamageEvents)
 	{
-		OnHealthChanged.Broadcast(healthVitality[0]->GetCurrentVitality(), healthVitality[0]->GetNormalizedVitality());
-		if (healthVitality[0]->GetCurrentVitality() <= 0)
+		// Batched events were filtered when queued, before any of them started i-frames or killed the character
+		if (!bCanBeDamaged || DamageGate.IsDead() || KillingEvent)
 		{
-			AActor* SourceActor = Cast<AActor>(damageEvent.Source);
+			INC_DWORD_STAT(STAT_RCCharacter_DamageEventsFiltered);
+			continue;
+		}
+
+		VitalityManager->HandleApplyDamageEvent(DamageEvent);
+		LastAppliedEvent = &DamageEvent;
+		if (!HealthVitality) continue;
+
+		if (HealthVitality->GetCurrentVitality() <= 0)
+		{
+			KillingEvent = &DamageEvent;
+		}
+
+		// Later events in the batch see the i-frames this hit starts, as they would unbatched
+		SetCanBeDamaged_Implementation(false);
+	}
+
+	if (HealthVitality && LastAppliedEvent)
+	{
+		OnHealthChanged.Broadcast(HealthVitality->GetCurrentVitality(), HealthVitality->GetNormalizedVitality());
+		if (KillingEvent)
+		{
+			AActor* SourceActor = Cast<AActor>(KillingEvent->Source);
 			DeathManager->SetIsDead(true, SourceActor);
 		}
-		OnInvincibilityStart(damageEvent);
+		OnInvincibilityStart(*LastAppliedEvent);
 		StartInvincibility();
 	}
+}
 
-	return IRCDamageableInterface::ApplyDamageEvent_Implementation(damageEvent);
+URCVitalityObject* ARCCharacter::GetHealthVitality()
+{
+	// Resolved once at BeginPlay, only searched again if the health object goes away
+	if (!CachedHealthVitality.IsValid())
+	{
+		ResolveHealthVitality();
+	}
+
+	return CachedHealthVitality.Get();
+}
+
+void ARCCharacter::ResolveHealthVitality()
+{
+	TArray<URCVitalityObject*> HealthVitality;
+	VitalityManager->GetVitalityObjectsByTag(HealthTag, HealthVitality);
+	CachedHealthVitality = HealthVitality.IsEmpty() ? nullptr : HealthVitality[0];
 }
 
 void ARCCharacter::StartInvincibility()
 {
 	SetCanBeDamaged_Implementation(false);
-	GetWorld()->GetTimerManager().SetTimer(
-		IFrameTimerHandle,
-		this,
-		&ARCCharacter::EndInvincibility,
-		InvincibilityDuration,
-		false
-	);
+	SetGameplayDeadline(ERCGameplayDeadline::IFrames, InvincibilityDuration);
+	UpdateCombatState();
 }
 
 void ARCCharacter::EndInvincibility()
 {
 	SetCanBeDamaged_Implementation(true);
+	UpdateCombatState();
+}
+
+void ARCCharacter::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	// The owner runs its own input, only other machines need the combat state
+	FDoRepLifetimeParams Params;
+	Params.bIsPushBased = true;
+	Params.Condition = COND_SkipOwner;
+	DOREPLIFETIME_WITH_PARAMS_FAST(ARCCharacter, CombatState, Params);
+}
+
+void ARCCharacter::UpdateCombatState()
+{
+	if (!HasAuthority() || GetNetMode() == NM_Standalone) return;
+
+	FRCReplicatedCombatState NewState;
+	NewState.CurrentEquippable = static_cast<uint8>(CurrentEquippable);
+	NewState.LastEquippable = static_cast<uint8>(LastEquippable);
+	NewState.SetFlag(ERCCombatStateFlags::Shielding, RCCharacterMovementComponent->bIsShielding);
+	NewState.SetFlag(ERCCombatStateFlags::Shooting, RCCharacterMovementComponent->IsShooting);
+	NewState.SetFlag(ERCCombatStateFlags::Meleeing, RCCharacterMovementComponent->IsMeleeing);
+	NewState.SetFlag(ERCCombatStateFlags::Invincible, !GetCanBeDamaged_Implementation());
+	if (RangedAttackChargeStartTime < MAX_FLT)
+	{
+		NewState.SetFlag(ERCCombatStateFlags::Charging, true);
+		NewState.ChargeStartFrame = static_cast<uint16>(FRCGameplayTimers::TimeToFrame(RangedAttackChargeStartTime));
+	}
+
+	// Only mark the property dirty when something a remote machine would see changed
+	if (NewState == CombatState) return;
+	CombatState = NewState;
+	MARK_PROPERTY_DIRTY_FROM_NAME(ARCCharacter, CombatState, this);
+}
+
+void ARCCharacter::OnRep_CombatState()
+{
+	CurrentEquippable = static_cast<EEquippable>(CombatState.CurrentEquippable);
+	LastEquippable = static_cast<EEquippable>(CombatState.LastEquippable);
+	ApplyEquippableVisibility(GetEquippableMask(CurrentEquippable));
+
+	SetIsShielding(CombatState.HasFlag(ERCCombatStateFlags::Shielding));
+	RCCharacterMovementComponent->IsShooting = CombatState.HasFlag(ERCCombatStateFlags::Shooting);
+	RCCharacterMovementComponent->IsMeleeing = CombatState.HasFlag(ERCCombatStateFlags::Meleeing);
+	SetCanBeDamaged_Implementation(!CombatState.HasFlag(ERCCombatStateFlags::Invincible));
+
+	// Rebuild the charge start in local time from how long the server has been charging
+	if (CombatState.HasFlag(ERCCombatStateFlags::Charging))
+	{
+		const AGameStateBase* GameState = GetWorld()->GetGameState();
+		const double ServerTime = GameState ? GameState->GetServerWorldTimeSeconds() : GetWorld()->GetTimeSeconds();
+		const int32 FramesCharging = CombatState.GetFramesCharging(FRCGameplayTimers::TimeToFrame(ServerTime));
+		SetRangedAttackChargeStartTime(GetWorld()->GetTimeSeconds() - FRCGameplayTimers::FramesToSeconds(FramesCharging));
+	}
+	else
+	{
+		SetRangedAttackChargeStartTime(MAX_FLT);
+	}
 }
 
 void ARCCharacter::OnInvincibilityStart_Implementation(FRCDamageEvent& damageEvent)
@@ -337,41 +950,116 @@ void ARCCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInputCompone
 	{
 		/// + MOVEMENT +
 		// Jump
-		EnhancedInputComponent->BindAction(JumpAction, ETriggerEvent::Triggered, this, &ARCCharacter::JumpOrDrop);
-		EnhancedInputComponent->BindAction(JumpAction, ETriggerEvent::Completed, this, &ARCCharacter::ReleaseJump);
+		RC_BIND_HANDLER(EnhancedInputComponent, JumpAction, ETriggerEvent::Triggered, JumpOrDrop);
+		RC_BIND_HANDLER(EnhancedInputComponent, JumpAction, ETriggerEvent::Completed, ReleaseJump);
 		// Crouch / Drop
-		EnhancedInputComponent->BindAction(CrouchDropAction, ETriggerEvent::Triggered, this, &ARCCharacter::CrouchDrop);
-		EnhancedInputComponent->BindAction(CrouchDropAction, ETriggerEvent::Completed, this,
-		                                   &ARCCharacter::StopCrouchDrop);
+		RC_BIND_HANDLER(EnhancedInputComponent, CrouchDropAction, ETriggerEvent::Triggered, CrouchDrop);
+		RC_BIND_HANDLER(EnhancedInputComponent, CrouchDropAction, ETriggerEvent::Completed, StopCrouchDrop);
 		// Move
 		EnhancedInputComponent->BindAction(MoveAction, ETriggerEvent::Triggered, this, &ARCCharacter::Move);
 		// Dash
-		EnhancedInputComponent->BindAction(DashAction, ETriggerEvent::Triggered, this, &ARCCharacter::Dash);
+		RC_BIND_HANDLER(EnhancedInputComponent, DashAction, ETriggerEvent::Triggered, Dash);
 
 		/// + COMBAT +
 		//Ranged
-		EnhancedInputComponent->BindAction(RangedAttackAction, ETriggerEvent::Started, this,
-		                                   &ARCCharacter::RangedAttack);
-		EnhancedInputComponent->BindAction(RangedAttackAction, ETriggerEvent::Completed, this,
-		                                   &ARCCharacter::ReleaseRangedAttack);
+		RC_BIND_HANDLER(EnhancedInputComponent, RangedAttackAction, ETriggerEvent::Started, RangedAttack);
+		RC_BIND_HANDLER(EnhancedInputComponent, RangedAttackAction, ETriggerEvent::Completed, ReleaseRangedAttack);
 		//Melee
-		EnhancedInputComponent->BindAction(MeleeAttackAction, ETriggerEvent::Started, this,
-		                                   &ARCCharacter::MeleeAttack);
-		EnhancedInputComponent->BindAction(MeleeAttackAction, ETriggerEvent::Completed, this,
-		                                   &ARCCharacter::ReleaseMeleeAttack);
+		RC_BIND_HANDLER(EnhancedInputComponent, MeleeAttackAction, ETriggerEvent::Started, MeleeAttack);
+		RC_BIND_HANDLER(EnhancedInputComponent, MeleeAttackAction, ETriggerEvent::Completed, ReleaseMeleeAttack);
 		//Shield
-		EnhancedInputComponent->BindAction(ShieldAction, ETriggerEvent::Started, this, &ARCCharacter::ActivateShield);
-		EnhancedInputComponent->BindAction(ShieldAction, ETriggerEvent::Completed, this, &ARCCharacter::ReleaseShield);
+		RC_BIND_HANDLER(EnhancedInputComponent, ShieldAction, ETriggerEvent::Started, ActivateShield);
+		RC_BIND_HANDLER(EnhancedInputComponent, ShieldAction, ETriggerEvent::Completed, ReleaseShield);
 
 		//Heal
-		EnhancedInputComponent->BindAction(HealAction, ETriggerEvent::Started, this, &ARCCharacter::ActivateHeal);
-		EnhancedInputComponent->BindAction(HealAction, ETriggerEvent::Completed, this, &ARCCharacter::ReleaseHeal);
+		RC_BIND_HANDLER(EnhancedInputComponent, HealAction, ETriggerEvent::Started, ActivateHeal);
+		RC_BIND_HANDLER(EnhancedInputComponent, HealAction, ETriggerEvent::Completed, ReleaseHeal);
 
 		/// + GAME MISC +
 		//Pause
-		EnhancedInputComponent->BindAction(PauseAction, ETriggerEvent::Triggered, this, &ARCCharacter::PauseGame);
+		RC_BIND_HANDLER(EnhancedInputComponent, PauseAction, ETriggerEvent::Triggered, PauseGame);
 		//Menu
-		EnhancedInputComponent->BindAction(MenuAction, ETriggerEvent::Triggered, this, &ARCCharacter::OpenMenu);
+		RC_BIND_HANDLER(EnhancedInputComponent, MenuAction, ETriggerEvent::Triggered, OpenMenu);
+
+		/// + RECORDING +
+		const FString RecordingFilePath = FRCInputRecorder::GetRequestedFilePath();
+		if (!RecordingFilePath.IsEmpty())
+		{
+			InputRecorder = MakeUnique<FRCInputRecorder>(RecordingFilePath);
+			BindInputRecording(EnhancedInputComponent);
+		}
+	}
+}
+
+void ARCCharacter::BindInputRecording(UEnhancedInputComponent* EnhancedInputComponent)
+{
+	// Mirrors the gameplay bindings above, each event is recorded alongside its normal handler
+	auto RecordAction = [this, EnhancedInputComponent](const UInputAction* Action, ERCRecordedAction RecordedAction,
+	                                                   ETriggerEvent TriggerEvent)
+	{
+		EnhancedInputComponent->BindActionValueLambda(Action, TriggerEvent,
+		                                              [this, RecordedAction, TriggerEvent](const FInputActionValue& Value)
+		                                              {
+			                                              InputRecorder->Record(RecordedAction, TriggerEvent,
+			                                                                    Value.Get<float>(),
+			                                                                    FRCGameplayTimers::GetFrame(GetWorld()));
+		                                              });
+	};
+
+	RecordAction(JumpAction, ERCRecordedAction::Jump, ETriggerEvent::Triggered);
+	RecordAction(JumpAction, ERCRecordedAction::Jump, ETriggerEvent::Completed);
+	RecordAction(CrouchDropAction, ERCRecordedAction::CrouchDrop, ETriggerEvent::Triggered);
+	RecordAction(CrouchDropAction, ERCRecordedAction::CrouchDrop, ETriggerEvent::Completed);
+	RecordAction(MoveAction, ERCRecordedAction::Move, ETriggerEvent::Triggered);
+	RecordAction(DashAction, ERCRecordedAction::Dash, ETriggerEvent::Triggered);
+	RecordAction(RangedAttackAction, ERCRecordedAction::Ranged, ETriggerEvent::Started);
+	RecordAction(RangedAttackAction, ERCRecordedAction::Ranged, ETriggerEvent::Completed);
+	RecordAction(MeleeAttackAction, ERCRecordedAction::Melee, ETriggerEvent::Started);
+	RecordAction(MeleeAttackAction, ERCRecordedAction::Melee, ETriggerEvent::Completed);
+	RecordAction(ShieldAction, ERCRecordedAction::Shield, ETriggerEvent::Started);
+	RecordAction(ShieldAction, ERCRecordedAction::Shield, ETriggerEvent::Completed);
+	RecordAction(HealAction, ERCRecordedAction::Heal, ETriggerEvent::Started);
+	RecordAction(HealAction, ERCRecordedAction::Heal, ETriggerEvent::Completed);
+}
+
+void ARCCharacter::ReplayRecordedInput(const FRCRecordedInput& Input)
+{
+	// Same handlers SetupPlayerInputComponent binds for each action and trigger event
+	const bool bCompleted = Input.TriggerEvent == ETriggerEvent::Completed;
+	switch (Input.Action)
+	{
+	case ERCRecordedAction::Move:
+		Move(FInputActionValue(Input.GetValue()));
+		break;
+	case ERCRecordedAction::Jump:
+		if (bCompleted) RC_DISPATCH_HANDLER(ReleaseJump);
+		else RC_DISPATCH_HANDLER(JumpOrDrop);
+		break;
+	case ERCRecordedAction::CrouchDrop:
+		if (bCompleted) RC_DISPATCH_HANDLER(StopCrouchDrop);
+		else RC_DISPATCH_HANDLER(CrouchDrop);
+		break;
+	case ERCRecordedAction::Dash:
+		RC_DISPATCH_HANDLER(Dash);
+		break;
+	case ERCRecordedAction::Ranged:
+		if (bCompleted) RC_DISPATCH_HANDLER(ReleaseRangedAttack);
+		else RC_DISPATCH_HANDLER(RangedAttack);
+		break;
+	case ERCRecordedAction::Melee:
+		if (bCompleted) RC_DISPATCH_HANDLER(ReleaseMeleeAttack);
+		else RC_DISPATCH_HANDLER(MeleeAttack);
+		break;
+	case ERCRecordedAction::Shield:
+		if (bCompleted) RC_DISPATCH_HANDLER(ReleaseShield);
+		else RC_DISPATCH_HANDLER(ActivateShield);
+		break;
+	case ERCRecordedAction::Heal:
+		if (bCompleted) RC_DISPATCH_HANDLER(ReleaseHeal);
+		else RC_DISPATCH_HANDLER(ActivateHeal);
+		break;
+	default:
+		break;
 	}
 }
 
@@ -443,76 +1131,73 @@ void ARCCharacter::ReleaseJump_Implementation()
 void ARCCharacter::RangedAttack_Implementation()
 {
 	// Get time, then see if we are buffering the input.
-	const float CurrentTime = GetWorld()->GetTimeSeconds();
-	if (!(LastEquipTime + EquipDelay < CurrentTime)
+	const int32 CurrentFrame = GetInputEventTime().Frame;
+	if (!(GetEquipReadyFrame() < CurrentFrame)
 		&& CurrentEquippable != EEquippable::EE_Ranged)
 	{
-		bWantsToShoot = true;
+		BufferInput(ERCBufferedInput::Shoot);
 		return;
 	}
 
 	// Remove the buffer
-	bWantsToShoot = false;
+	InputBuffer.Remove(ERCBufferedInput::Shoot);
 
 	// Inform BP / Anim
 	RCCharacterMovementComponent->IsShooting = true;
-	if (SwapEquippable(EEquippable::EE_Ranged))
+	UpdateCombatState();
+	if (RC_DISPATCH_HANDLER(SwapEquippable, EEquippable::EE_Ranged, false))
 	{
-		RCCharacterMovementComponent->bIsShielding = false;
+		SetIsShielding(false);
 	}
 
-	RangedAttackChargeStartTime = CurrentTime;
-	PlayTriggerRangedSuccessVFX();
-	PlayFireRangedSuccessVFX();
+	SetRangedAttackChargeStartTime(GetInputEventTime().Seconds);
+	PlayCombatVFX(ERCCombatVFX::TriggerRangedSuccess);
+	PlayCombatVFX(ERCCombatVFX::FireRangedSuccess);
 	FireRangedAttack();
 }
 
 void ARCCharacter::ReleaseRangedAttack_Implementation()
 {
-	const float CurrentTime = GetWorld()->GetTimeSeconds();
-	if (!(LastEquipTime + EquipDelay < CurrentTime)
+	const int32 CurrentFrame = GetInputEventTime().Frame;
+	if (!(GetEquipReadyFrame() < CurrentFrame)
 		&& CurrentEquippable != EEquippable::EE_Ranged)
 	{
-		bWantsToReleaseShoot = true;
-		bWantsToReleaseMelee = false;
+		BufferInput(ERCBufferedInput::ReleaseShoot);
+		InputBuffer.Remove(ERCBufferedInput::ReleaseMelee);
 		return;
 	}
 
 	if (RangedAttackChargeStartTime == MAX_FLT) return;
 
 	// Cache the current time input was released then compare to ranged attack delay.
-	if (!(LastRangedAttackTime + RangedAttackDelay < CurrentTime))
+	if (!(Timers.LastRangedAttackFrame + FRCGameplayTimers::SecondsToFrames(RangedAttackDelay) < CurrentFrame))
 	{
-		bWantsToReleaseShoot = true;
+		BufferInput(ERCBufferedInput::ReleaseShoot);
 		return;
 	}
 
 	if (CurrentEquippable != EEquippable::EE_Ranged) return;
 
-	bWantsToShoot = false;
-	bWantsToReleaseShoot = false;
+	InputBuffer.Remove(ERCBufferedInput::Shoot);
+	InputBuffer.Remove(ERCBufferedInput::ReleaseShoot);
 
-	// Calculate how long the player has been charging their attack clamped to a max of 10.
-	int32 ChargeTime = FMath::Clamp(FMath::FloorToInt32(GetWorld()->GetTimeSeconds() - RangedAttackChargeStartTime), 0,
-	                                10);
-	if (ChargeTime >= 1)
+	// Calculate how long the player has been charging their attack, from press to release as they happened.
+	const float ChargeTime = GetInputEventTime().Seconds - RangedAttackChargeStartTime;
+	if (ChargeTime >= 1.f)
 	{
 		FireRangedAttack();
-		LastRangedAttackTime = CurrentTime;
-		PlayFireRangedSuccessVFX();
+		Timers.LastRangedAttackFrame = CurrentFrame;
+		PlayCombatVFX(ERCCombatVFX::FireRangedSuccess);
 	}
 	
-	RangedAttackChargeStartTime = MAX_FLT;
-	PlayReleaseRangedSuccessVFX();
-	LastEquipTime = CurrentTime;
+	SetRangedAttackChargeStartTime(MAX_FLT);
+	PlayCombatVFX(ERCCombatVFX::ReleaseRangedSuccess);
+	Timers.LastEquipFrame = CurrentFrame;
 }
 
 void ARCCharacter::FireRangedAttack()
 {
-	// We are eligible for fire, let's define params.
-	FActorSpawnParameters SpawnParameters;
-	SpawnParameters.Owner = this;
-	SpawnParameters.Instigator = this;
+	RC_CHARACTER_SCOPE(FireRangedAttack);
 
 	// Set the location and rotation where we want to spawn the projectile.
 	const FVector ActorLocation = GetActorLocation();
@@ -523,113 +1208,140 @@ void ARCCharacter::FireRangedAttack()
 	SpawnLocation += ProjectileSpawnLocationModifier;
 	const FRotator SpawnRotation = FRotator(FMath::Sign(GetActorForwardVector().X) * 90 - 90, 0, 0);
 
-	if (RangedProjectiles.IsEmpty())
-	{
-		UE_LOG(LogTemp, Error, TEXT("The HERO ranged projectile array is empty! Assign a value to the array."));
-		return;
-	}
+	// Misconfigured projectile arrays are reported when the table is built
+	if (ChargeProjectileTable.IsEmpty()) return;
+
+	// Calculate how long the player has been charging their attack, the table clamps it to its max.
+	const float ChargeTime = GetInputEventTime().Seconds - RangedAttackChargeStartTime;
 
-	// Calculate how long the player has been charging their attack clamped to a max of 10.
-	int32 ChargeTime = FMath::Clamp(FMath::FloorToInt32(GetWorld()->GetTimeSeconds() - RangedAttackChargeStartTime), 0,
-	                                10);
+	// Kinematic projectiles are moved by the manager, their bodies never need to simulate
+	URCProjectileManagerSubsystem* ProjectileManager = bUseKinematicProjectiles
+		                                                   ? GetWorld()->GetSubsystem<URCProjectileManagerSubsystem>()
+		                                                   : nullptr;
 
-	// Spawn the projectile based on what is set in the inspector.
-	ARCProjectile* Projectile = GetWorld()->SpawnActor<ARCProjectile>(
-		GetProjectileForCharge(ChargeTime), SpawnLocation,
-		SpawnRotation, SpawnParameters);
+	// Take the projectile based on what is set in the inspector from the pool, it spawns one on a miss.
+	URCProjectilePoolSubsystem* ProjectilePool = GetWorld()->GetSubsystem<URCProjectilePoolSubsystem>();
+	if (!ProjectilePool) return;
+	ARCProjectile* Projectile = ProjectilePool->Acquire(GetProjectileForCharge(ChargeTime),
+	                                                    FTransform(SpawnRotation, SpawnLocation), this, this,
+	                                                    ProjectileManager != nullptr);
 
 	if (!Projectile)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("Projectile failed to spawn!"));
 		return;
 	}
+	INC_DWORD_STAT(STAT_RCCharacter_ProjectilesSpawned);
+
+	const float Facing = FMath::Sign(GetActorForwardVector().X);
+	if (ProjectileManager)
+	{
+		// Launched at the class's speed on top of the character's own, like the impulse carries its velocity
+		ProjectileManager->Launch(Projectile, FVector(GetVelocity().X + Facing * Projectile->LaunchSpeed, 0, 0));
+		return;
+	}
 
 	// Add an impulse to the spawned projectile's root primitive component. (MUST HAVE PHYSICS ENABLED)
-	FVector ProjectileImpulse = FVector(FMath::Sign(GetActorForwardVector().X) * ProjectileImpulseForce, 0, 0);
 	UPrimitiveComponent* root = Cast<UPrimitiveComponent>(Projectile->GetRootComponent());
+	if (!root)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Projectile %s has no primitive root to launch!"), *GetNameSafe(Projectile));
+		return;
+	}
+	FVector ProjectileImpulse = FVector(Facing * ProjectileImpulseForce, 0, 0);
+	const FVector LaunchImpulse = (GetVelocity().X * FVector::ForwardVector) + ProjectileImpulse;
 
 	// Charge attack logic
-	root->AddImpulse((GetVelocity().X * FVector::ForwardVector) + ProjectileImpulse);
+	root->AddImpulse(LaunchImpulse);
 }
 
 void ARCCharacter::MeleeAttack_Implementation()
 {
 	// Get time, then see if we are buffering the input.
-	const float CurrentTime = GetWorld()->GetTimeSeconds();
-	if ((LastEquipTime + EquipDelay) > CurrentTime
+	const int32 CurrentFrame = GetInputEventTime().Frame;
+	if (GetEquipReadyFrame() > CurrentFrame
 		&& CurrentEquippable != EEquippable::EE_Melee)
 	{
-		bWantsToMelee = true;
+		BufferInput(ERCBufferedInput::Melee);
 		return;
 	}
-	bWantsToMelee = false;
+	InputBuffer.Remove(ERCBufferedInput::Melee);
 
 	if (RangedAttackChargeStartTime > 0 &&
 		RangedAttackChargeStartTime < MAX_FLT &&
 		CurrentEquippable == EEquippable::EE_Ranged)
 	{
-		PlayReleaseRangedFailureVFX();
+		PlayCombatVFX(ERCCombatVFX::ReleaseRangedFailure);
 	}
 
 	// Inform BP / Anim
 	RCCharacterMovementComponent->IsMeleeing = true;
-	if (SwapEquippable(EEquippable::EE_Melee))
+	UpdateCombatState();
+	if (RC_DISPATCH_HANDLER(SwapEquippable, EEquippable::EE_Melee, false))
 	{
-		RCCharacterMovementComponent->bIsShielding = false;
+		SetIsShielding(false);
 	}
 
-	if (LastMeleeAttackTime + MeleeAttackDelay > CurrentTime) return;	// Melee cooldown
-	PlayMeleeSuccessVFX();
-	LastMeleeAttackTime = CurrentTime;
-	LastEquipTime = CurrentTime;
+	if (GetMeleeReadyFrame() > CurrentFrame) return;	// Melee cooldown
+	PlayCombatVFX(ERCCombatVFX::MeleeSuccess);
+	Timers.LastMeleeAttackFrame = CurrentFrame;
+	Timers.LastEquipFrame = CurrentFrame;
 }
 
 void ARCCharacter::ReleaseMeleeAttack_Implementation()
 {
 	//UE_LOG(LogTemp, Log, TEXT("Melee Release Attempted"));
 	// Cache the current time input was released then compare to melee attack delay.
-	float CurrentTime = GetWorld()->GetTimeSeconds();
-	if ((LastEquipTime + EquipDelay) > CurrentTime
+	const int32 CurrentFrame = GetInputEventTime().Frame;
+	if (GetEquipReadyFrame() > CurrentFrame
 		&& CurrentEquippable != EEquippable::EE_Melee)
 	{
-		bWantsToReleaseShoot = false;
-		bWantsToReleaseMelee = true;
+		InputBuffer.Remove(ERCBufferedInput::ReleaseShoot);
+		BufferInput(ERCBufferedInput::ReleaseMelee);
 		return;
 	}
 	if (RangedAttackChargeStartTime > 0 && RangedAttackChargeStartTime < MAX_FLT) return; //
-	if (LastMeleeAttackTime + MeleeAttackDelay > CurrentTime) return;	// Melee cooldown
+	if (GetMeleeReadyFrame() > CurrentFrame) return;	// Melee cooldown
 	if (CurrentEquippable != EEquippable::EE_Melee) return; //
 
-	bWantsToMelee = false;
-	bWantsToReleaseMelee = false;
+	InputBuffer.Remove(ERCBufferedInput::Melee);
+	InputBuffer.Remove(ERCBufferedInput::ReleaseMelee);
 	RCCharacterMovementComponent->IsMeleeing = false;
+	UpdateCombatState();
 }
 
 void ARCCharacter::ActivateShield_Implementation()
 {
 	// Shield Buffer for when the player holds down the input
 	//	but equip delays won't allow for the ability to fire yet.
-	float CurrentTime = GetWorld()->GetTimeSeconds();
-	if ((LastEquipTime + EquipDelay) > CurrentTime)
+	const int32 CurrentFrame = GetInputEventTime().Frame;
+	if (GetEquipReadyFrame() > CurrentFrame)
 	{
-		bWantsToShield = true;
+		BufferInput(ERCBufferedInput::Shield);
 		return;
 	}
 
-	// Activate shield
-	bWantsToShield = false; // Clear buffer
-	RangedAttackChargeStartTime = MAX_FLT;
-	RCCharacterMovementComponent->bIsShielding = SwapEquippable(EEquippable::EE_Shield);
-	PlayReleaseRangedFailureVFX();
-	PlayShieldSuccessVFX();
+	// Activate shield, the swap fails a charge shot that was in progress
+	InputBuffer.Remove(ERCBufferedInput::Shield); // Clear buffer
+	SetIsShielding(RC_DISPATCH_HANDLER(SwapEquippable, EEquippable::EE_Shield, false));
+	SetRangedAttackChargeStartTime(MAX_FLT);
+	PlayCombatVFX(ERCCombatVFX::ShieldSuccess);
 }
 
 void ARCCharacter::ReleaseShield_Implementation()
 {
-	bWantsToShield = false;
+	InputBuffer.Remove(ERCBufferedInput::Shield);
 	if (CurrentEquippable != EEquippable::EE_Shield) return;
-	RCCharacterMovementComponent->bIsShielding = false;
-	SwapEquippable(LastEquippable, true);
+	SetIsShielding(false);
+	RC_DISPATCH_HANDLER(SwapEquippable, LastEquippable, true);
+}
+
+void ARCCharacter::SetIsShielding(bool bIsShielding)
+{
+	// The shield only blocks while it is up
+	RCCharacterMovementComponent->bIsShielding = bIsShielding;
+	ShieldEquippable->SetShieldRaised(bIsShielding);
+	UpdateCombatState();
 }
 
 void ARCCharacter::PauseGame_Implementation()
@@ -646,29 +1358,89 @@ void ARCCharacter::ActivateHeal_Implementation()
 {
 	UE_LOG(LogTemp, Display, TEXT("ActivateHeal_Implementation"));
 	bIsHealing = true;
-	PlayShieldSuccessVFX();
+	PlayCombatVFX(ERCCombatVFX::ShieldSuccess);
 }
 
 void ARCCharacter::ReleaseHeal_Implementation()
 {
 	UE_LOG(LogTemp, Display, TEXT("ReleaseHeal_Implementation"));
 	bIsHealing = false;
-	PlayHealFinishVFX();
+	PlayCombatVFX(ERCCombatVFX::HealFinish);
+}
+
+void ARCCharacter::PlayCombatVFX(ERCCombatVFX Event)
+{
+	// Nobody can see the character, skip table and Blueprint effects alike
+	if (SignificanceTier == ERCSignificanceTier::Hidden) return;
+
+	// Each event plays at most once per character per frame
+	if (CombatVFXFrame != GFrameCounter)
+	{
+		CombatVFXFrame = GFrameCounter;
+		PlayedCombatVFXMask = 0;
+	}
+	const uint32 EventBit = 1u << static_cast<uint32>(Event);
+	if (PlayedCombatVFXMask & EventBit)
+	{
+		INC_DWORD_STAT(STAT_RCCharacter_CombatVFXDeduplicated);
+		return;
+	}
+	PlayedCombatVFXMask |= EventBit;
+
+	// Events in the table are played natively, even when culled
+	if (const FRCCombatVFXEntry* Entry = CombatVFXTable ? CombatVFXTable->Find(Event) : nullptr)
+	{
+		if (URCCombatVFXSubsystem* CombatVFX = GetWorld()->GetSubsystem<URCCombatVFXSubsystem>())
+		{
+			CombatVFX->Play(*Entry, GetMesh());
+		}
+		return;
+	}
+
+	switch (Event)
+	{
+	case ERCCombatVFX::TriggerRangedSuccess:
+		PlayTriggerRangedSuccessVFX();
+		break;
+	case ERCCombatVFX::FireRangedSuccess:
+		PlayFireRangedSuccessVFX();
+		break;
+	case ERCCombatVFX::ReleaseRangedSuccess:
+		PlayReleaseRangedSuccessVFX();
+		break;
+	case ERCCombatVFX::ReleaseRangedFailure:
+		PlayReleaseRangedFailureVFX();
+		break;
+	case ERCCombatVFX::MeleeSuccess:
+		PlayMeleeSuccessVFX();
+		break;
+	case ERCCombatVFX::ShieldSuccess:
+		PlayShieldSuccessVFX();
+		break;
+	case ERCCombatVFX::HealFinish:
+		PlayHealFinishVFX();
+		break;
+	default:
+		break;
+	}
 }
 
 bool ARCCharacter::SwapEquippable_Implementation(EEquippable ToEquip, bool IsForced)
 {
+	RC_CHARACTER_SCOPE(SwapEquippable);
+
 	if (CurrentEquippable == ToEquip) { return true; }
 
 	if (!IsForced)
 	{
-		float CurrentTime = GetWorld()->GetTimeSeconds();
+		const int32 CurrentFrame = GetInputEventTime().Frame;
 		// The player is trying to swap too fast.
-		if (!(LastEquipTime + EquipDelay < CurrentTime))
+		if (!(GetEquipReadyFrame() < CurrentFrame))
 		{
+			INC_DWORD_STAT(STAT_RCCharacter_EquipSwapsRejected);
 			return false;
 		}
-		LastEquipTime = CurrentTime;
+		Timers.LastEquipFrame = CurrentFrame;
 	}
 
 	// Save current weapon as LastEquippable ONLY if we're switching to shield or none
@@ -683,50 +1455,17 @@ bool ARCCharacter::SwapEquippable_Implementation(EEquippable ToEquip, bool IsFor
 	}
 
 	// If the player interrupted the charge shot with shield we want to fail the charge shot.
-	if (CurrentEquippable == EEquippable::EE_Ranged && ToEquip == EEquippable::EE_Shield)
+	if (CurrentEquippable == EEquippable::EE_Ranged && ToEquip == EEquippable::EE_Shield &&
+		RangedAttackChargeStartTime < MAX_FLT)
 	{
-		PlayReleaseRangedFailureVFX();
+		PlayCombatVFX(ERCCombatVFX::ReleaseRangedFailure);
 	}
 
-	switch (ToEquip)
-	{
-	case EEquippable::EE_Ranged:
-		if (RangedEquippable) RangedEquippable->SetVisibility(true);
-		else SetupEquippable(ToEquip);
-
-		if (MeleeEquippable) MeleeEquippable->SetVisibility(false);
-		if (ShieldEquippableObject) ShieldEquippableObject->SetVisibility(false);
-
-		break;
-
-	case EEquippable::EE_Melee:
-		if (MeleeEquippable) MeleeEquippable->SetVisibility(true);
-		else SetupEquippable(ToEquip);
-
-		if (RangedEquippable) RangedEquippable->SetVisibility(false);
-		if (ShieldEquippableObject) ShieldEquippableObject->SetVisibility(false);
-
-		break;
-
-	case EEquippable::EE_Shield:
-		if (ShieldEquippableObject) ShieldEquippableObject->SetVisibility(true);
-		else SetupEquippable(ToEquip);
-
-		if (RangedEquippable) RangedEquippable->SetVisibility(false);
-		if (MeleeEquippable) MeleeEquippable->SetVisibility(false);
-		break;
-
-	case EEquippable::EE_None:
-		if (RangedEquippable) RangedEquippable->SetVisibility(false);
-		if (MeleeEquippable) MeleeEquippable->SetVisibility(false);
-		if (ShieldEquippableObject) ShieldEquippableObject->SetVisibility(false);
-		break;
-
-	default:
-		break;
-	}
+	ApplyEquippableVisibility(GetEquippableMask(ToEquip));
+	InvalidateIgnoreSelfParams();
 
 	CurrentEquippable = ToEquip;
+	UpdateCombatState();
 	return true;
 }
 
@@ -763,6 +1502,8 @@ void ARCCharacter::Landed(const FHitResult& Hit)
 
 void ARCCharacter::CheckJumpInput(float DeltaTime)
 {
+	RC_CHARACTER_SCOPE(CheckJumpInput);
+
 	// Override default class to make it so the player needs to press jump multiple times for multiple jumps.
 	JumpCurrentCountPreJump = JumpCurrentCount;
 
@@ -777,14 +1518,8 @@ void ARCCharacter::CheckJumpInput(float DeltaTime)
 			{
 				if (bInCoyoteTime && RCCharacterMovementComponent->IsFalling())
 				{
-					if (JumpCoyoteTimerHandle.IsValid())
-					{
-						// Clear the timer, which stops it from executing
-						GetWorld()->GetTimerManager().ClearTimer(JumpCoyoteTimerHandle);
-
-						// Invalidate the handle after clearing the timer
-						JumpCoyoteTimerHandle.Invalidate();
-					}
+					// Clear the coyote deadline, which stops it from counting the fall as a jump
+					Timers.ClearDeadline(ERCGameplayDeadline::Coyote);
 
 					// Set the current movement mode to Walking to trigger a JumpCurrentCount0 jump.
 					RCCharacterMovementComponent->SetMovementMode(MOVE_Walking);
@@ -820,42 +1555,35 @@ void ARCCharacter::OnMovementModeChanged(EMovementMode PrevMovementMode, uint8 P
 	{
 		bInCoyoteTime = true;
 
-		// Capture 'this' as a weak pointer to avoid a strong reference cycle.
-		TWeakObjectPtr<ARCCharacter> WeakThis(this);
-
-		// Use a lambda to define the timer's logic.
-		FTimerDelegate TimerDelegate;
-		TimerDelegate.BindLambda([WeakThis]()
-		{
-			// Check if the object is still valid before accessing it.
-			if (WeakThis.IsValid())
-			{
-				if (WeakThis->RCCharacterMovementComponent->IsFalling() && WeakThis->JumpCurrentCount <= 0)
-				{
-					WeakThis->JumpCurrentCount++;
-					WeakThis->bInCoyoteTime = false;
-				}
-			}
-		});
+		// Once coyote time runs out the fall counts as a jump, see HandleExpiredDeadlines
+		SetGameplayDeadline(ERCGameplayDeadline::Coyote, JumpCoyoteTime);
+	}
+}
 
-		// Set the timer using the FTimerDelegate.
-		GetWorld()->GetTimerManager().SetTimer(
-			JumpCoyoteTimerHandle,
-			TimerDelegate,
-			JumpCoyoteTime,
-			false
-		);
+const FCollisionQueryParams& ARCCharacter::GetIgnoreSelfParams() const
+{
+	// Rebuilt only when the equippables change, anything else attaching to the character must invalidate
+	if (bIgnoreSelfParamsDirty)
+	{
+		RebuildIgnoreSelfParams();
 	}
+
+	return IgnoreSelfParams;
 }
 
-FCollisionQueryParams ARCCharacter::GetIgnoreSelfParams() const
+void ARCCharacter::InvalidateIgnoreSelfParams()
 {
-	FCollisionQueryParams Params;
-	TArray<AActor*> SelfChildren;
+	bIgnoreSelfParamsDirty = true;
+}
 
+void ARCCharacter::RebuildIgnoreSelfParams() const
+{
+	TArray<AActor*> SelfChildren;
 	GetAllChildActors(SelfChildren);
-	Params.AddIgnoredActors(SelfChildren);
-	Params.AddIgnoredActor(this);
+	GetAttachedActors(SelfChildren, false, true);
 
-	return Params;
+	IgnoreSelfParams = FCollisionQueryParams();
+	IgnoreSelfParams.AddIgnoredActors(SelfChildren);
+	IgnoreSelfParams.AddIgnoredActor(this);
+	bIgnoreSelfParamsDirty = false;
 }
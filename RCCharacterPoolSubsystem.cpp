@@ -0,0 +1,133 @@
+// Copyright 2026 Michael DiLucca.
+
+#include "RCCharacterPoolSubsystem.h"
+
+#include "RCCharacter.h"
+#include "RCCharacterStats.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "Engine/World.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Character Pool Hits"), STAT_RCCharacterPoolHits, STATGROUP_RCCharacter);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Character Pool Misses"), STAT_RCCharacterPoolMisses, STATGROUP_RCCharacter);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Dormant Characters"), STAT_RCCharacterPoolDormant, STATGROUP_RCCharacter);
+
+void URCCharacterPoolSubsystem::Prewarm(TSubclassOf<ARCCharacter> CharacterClass, int32 Count)
+{
+	if (!CharacterClass) return;
+
+	FRCCharacterPool& Pool = Pools.FindOrAdd(CharacterClass);
+	if (!Pool.CombatAssetsHandle.IsValid())
+	{
+		Pool.CombatAssetsHandle = ARCCharacter::PreloadCombatAssets(CharacterClass, FStreamableDelegate());
+	}
+
+	while (Pool.Available.Num() < Count)
+	{
+		ARCCharacter* Character = SpawnCharacter(CharacterClass, FTransform::Identity);
+		if (!Character) return;
+
+		Deactivate(Character);
+		Pool.Available.Add(Character);
+		INC_DWORD_STAT(STAT_RCCharacterPoolDormant);
+	}
+}
+
+ARCCharacter* URCCharacterPoolSubsystem::Acquire(TSubclassOf<ARCCharacter> CharacterClass,
+                                                 const FTransform& Transform)
+{
+	if (!CharacterClass) return nullptr;
+
+	FRCCharacterPool& Pool = Pools.FindOrAdd(CharacterClass);
+
+	// Pooled characters can still be destroyed by other code, skip any that were
+	ARCCharacter* Character = nullptr;
+	while (!Character && !Pool.Available.IsEmpty())
+	{
+		Character = Pool.Available.Pop(EAllowShrinking::No);
+		DEC_DWORD_STAT(STAT_RCCharacterPoolDormant);
+		if (!IsValid(Character))
+		{
+			Character = nullptr;
+		}
+	}
+
+	if (Character)
+	{
+		INC_DWORD_STAT(STAT_RCCharacterPoolHits);
+		Activate(Character, Transform);
+	}
+	else
+	{
+		// A fresh character is already in its initial state
+		INC_DWORD_STAT(STAT_RCCharacterPoolMisses);
+		Character = SpawnCharacter(CharacterClass, Transform);
+		if (!Character) return nullptr;
+	}
+
+	ActiveCharacters.Add(Character);
+	return Character;
+}
+
+void URCCharacterPoolSubsystem::Release(ARCCharacter* Character)
+{
+	if (!IsValid(Character) || ActiveCharacters.Remove(Character) == 0) return;
+
+	Deactivate(Character);
+	Pools.FindOrAdd(Character->GetClass()).Available.Add(Character);
+	INC_DWORD_STAT(STAT_RCCharacterPoolDormant);
+}
+
+void URCCharacterPoolSubsystem::Deinitialize()
+{
+	for (const TPair<TObjectPtr<UClass>, FRCCharacterPool>& Pair : Pools)
+	{
+		DEC_DWORD_STAT_BY(STAT_RCCharacterPoolDormant, Pair.Value.Available.Num());
+	}
+	Pools.Empty();
+	ActiveCharacters.Empty();
+
+	Super::Deinitialize();
+}
+
+bool URCCharacterPoolSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+ARCCharacter* URCCharacterPoolSubsystem::SpawnCharacter(UClass* CharacterClass, const FTransform& Transform) const
+{
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+	ARCCharacter* Character = GetWorld()->SpawnActor<ARCCharacter>(CharacterClass, Transform, SpawnParameters);
+	if (!Character)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Character pool failed to spawn %s!"), *GetNameSafe(CharacterClass));
+	}
+	return Character;
+}
+
+void URCCharacterPoolSubsystem::Activate(ARCCharacter* Character, const FTransform& Transform)
+{
+	Character->SetActorTransform(Transform, false, nullptr, ETeleportType::ResetPhysics);
+	Character->GetMesh()->SetComponentTickEnabled(true);
+	Character->GetCharacterMovement()->SetComponentTickEnabled(true);
+	Character->SetActorHiddenInGame(false);
+	Character->SetActorEnableCollision(true);
+	Character->ResetForReuse();
+}
+
+void URCCharacterPoolSubsystem::Deactivate(ARCCharacter* Character)
+{
+	// Dormant characters don't animate, move or take part in collision
+	Character->GetCharacterMovement()->StopMovementImmediately();
+	Character->GetCharacterMovement()->DisableMovement();
+	Character->GetCharacterMovement()->SetComponentTickEnabled(false);
+	Character->GetMesh()->SetComponentTickEnabled(false);
+	Character->SetActorHiddenInGame(true);
+	Character->SetActorEnableCollision(false);
+
+	// Nothing buffered or scheduled may fire while dormant
+	Character->ClearCombatState();
+}
@@ -0,0 +1,71 @@
+// Copyright 2026 Michael DiLucca.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/StreamableManager.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Templates/SubclassOf.h"
+#include "RCCharacterPoolSubsystem.generated.h"
+
+class ARCCharacter;
+
+/** Dormant characters of a single class. */
+USTRUCT()
+struct FRCCharacterPool
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<TObjectPtr<ARCCharacter>> Available;
+
+	/** Keeps the class's combat assets resident while the pool exists, so a wave doesn't wait on them. */
+	TSharedPtr<FStreamableHandle> CombatAssetsHandle;
+};
+
+/**
+ * Per-world pool of dormant ARCCharacters, keyed by class, so respawn waves reuse characters instead of
+ * spawning new ones. Acquire runs ARCCharacter::ResetForReuse on a pooled character and only spawns on a miss.
+ * Controllers are left as they are: a released character keeps its controller, an acquired one is not repossessed.
+ */
+UCLASS()
+class URCCharacterPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Make sure at least Count dormant characters of the class are ready, and start loading its combat assets. */
+	void Prewarm(TSubclassOf<ARCCharacter> CharacterClass, int32 Count);
+
+	/** Take a character from the pool, spawning one on a miss, and place it at Transform ready to play. */
+	ARCCharacter* Acquire(TSubclassOf<ARCCharacter> CharacterClass, const FTransform& Transform);
+
+	/**
+	 * Put an acquired character back into the pool of its class. It is hidden, made non-colliding, stops moving and
+	 * drops its pending combat state. Characters that are not currently acquired are ignored, so releasing twice is
+	 * harmless.
+	 */
+	void Release(ARCCharacter* Character);
+
+	bool IsAcquired(const ARCCharacter* Character) const
+	{
+		return ActiveCharacters.Contains(const_cast<ARCCharacter*>(Character));
+	}
+
+	virtual void Deinitialize() override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	ARCCharacter* SpawnCharacter(UClass* CharacterClass, const FTransform& Transform) const;
+
+	static void Activate(ARCCharacter* Character, const FTransform& Transform);
+	static void Deactivate(ARCCharacter* Character);
+
+	UPROPERTY(Transient)
+	TMap<TObjectPtr<UClass>, FRCCharacterPool> Pools;
+
+	/** Acquired characters, weak since other code may still destroy a character. */
+	TSet<TWeakObjectPtr<ARCCharacter>> ActiveCharacters;
+};
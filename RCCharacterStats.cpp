@@ -0,0 +1,21 @@
+// Copyright 2026 Michael DiLucca.
+
+#include "RCCharacterStats.h"
+
+DEFINE_STAT(STAT_RCCharacter_Tick);
+DEFINE_STAT(STAT_RCCharacter_ApplyDamageEvent);
+DEFINE_STAT(STAT_RCCharacter_FireRangedAttack);
+DEFINE_STAT(STAT_RCCharacter_SwapEquippable);
+DEFINE_STAT(STAT_RCCharacter_SetupEquippable);
+DEFINE_STAT(STAT_RCCharacter_CheckJumpInput);
+
+DEFINE_STAT(STAT_RCCharacter_BufferedInputsConsumed);
+DEFINE_STAT(STAT_RCCharacter_BufferedInputsExpired);
+DEFINE_STAT(STAT_RCCharacter_ProjectilesSpawned);
+DEFINE_STAT(STAT_RCCharacter_EquipSwapsRejected);
+DEFINE_STAT(STAT_RCCharacter_DamageEventsFiltered);
+DEFINE_STAT(STAT_RCCharacter_CombatVFXDeduplicated);
+
+#if RC_CHARACTER_TRACE_ENABLED
+UE_TRACE_CHANNEL_DEFINE(RCCharacterChannel);
+#endif
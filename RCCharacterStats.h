@@ -0,0 +1,45 @@
+// Copyright 2026 Michael DiLucca.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+/** The RCCharacter trace channel only exists in non-shipping builds with trace enabled. */
+#define RC_CHARACTER_TRACE_ENABLED (UE_TRACE_ENABLED && !UE_BUILD_SHIPPING)
+
+DECLARE_STATS_GROUP(TEXT("RCCharacter"), STATGROUP_RCCharacter, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Tick"), STAT_RCCharacter_Tick, STATGROUP_RCCharacter, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("ApplyDamageEvent"), STAT_RCCharacter_ApplyDamageEvent, STATGROUP_RCCharacter, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("FireRangedAttack"), STAT_RCCharacter_FireRangedAttack, STATGROUP_RCCharacter, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("SwapEquippable"), STAT_RCCharacter_SwapEquippable, STATGROUP_RCCharacter, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("SetupEquippable"), STAT_RCCharacter_SetupEquippable, STATGROUP_RCCharacter, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("CheckJumpInput"), STAT_RCCharacter_CheckJumpInput, STATGROUP_RCCharacter, );
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Buffered Inputs Consumed"), STAT_RCCharacter_BufferedInputsConsumed,
+                                  STATGROUP_RCCharacter, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Buffered Inputs Expired"), STAT_RCCharacter_BufferedInputsExpired,
+                                  STATGROUP_RCCharacter, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Projectiles Spawned"), STAT_RCCharacter_ProjectilesSpawned,
+                                  STATGROUP_RCCharacter, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Equip Swaps Rejected"), STAT_RCCharacter_EquipSwapsRejected,
+                                  STATGROUP_RCCharacter, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Damage Events Filtered"), STAT_RCCharacter_DamageEventsFiltered,
+                                  STATGROUP_RCCharacter, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Combat VFX Deduplicated"), STAT_RCCharacter_CombatVFXDeduplicated,
+                                  STATGROUP_RCCharacter, );
+
+#if RC_CHARACTER_TRACE_ENABLED
+UE_TRACE_CHANNEL_EXTERN(RCCharacterChannel);
+#define RC_CHARACTER_TRACE_SCOPE(Name) TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR("RCCharacter::" #Name, RCCharacterChannel)
+#else
+#define RC_CHARACTER_TRACE_SCOPE(Name)
+#endif
+
+/** Cycle stat plus an Insights scope on the RCCharacter channel. Enable the channel with -trace=rccharacter. */
+#define RC_CHARACTER_SCOPE(Name) \
+	SCOPE_CYCLE_COUNTER(STAT_RCCharacter_##Name); \
+	RC_CHARACTER_TRACE_SCOPE(Name)
@@ -0,0 +1,79 @@
+// Copyright 2026 Michael DiLucca.
+
+#include "RCChargeProjectileTable.h"
+
+#include "ChargedProjectile.h"
+#include "Algo/StableSort.h"
+
+void FRCChargeProjectileTable::Build(const TArray<FChargedProjectile>& Entries, const UObject* Owner)
+{
+	Classes.Reset();
+	FMemory::Memset(StepToClass, NoProjectile, sizeof(StepToClass));
+	bIsBuilt = true;
+
+	if (Entries.IsEmpty())
+	{
+		UE_LOG(LogTemp, Error, TEXT("%s: the ranged projectile array is empty! Assign a value to the array."),
+		       *GetNameSafe(Owner));
+		return;
+	}
+
+	// Sort by threshold, keeping array order for equal thresholds so the first entry wins as before
+	TArray<const FChargedProjectile*, TInlineAllocator<8>> Sorted;
+	for (const FChargedProjectile& Entry : Entries)
+	{
+		Sorted.Add(&Entry);
+	}
+	Algo::StableSortBy(Sorted, [](const FChargedProjectile* Entry)
+	{
+		return static_cast<float>(Entry->ChargeTimeInSeconds);
+	});
+
+	for (int32 i = 0; i < Sorted.Num(); ++i)
+	{
+		const float Threshold = static_cast<float>(Sorted[i]->ChargeTimeInSeconds);
+		if (i > 0 && Threshold == static_cast<float>(Sorted[i - 1]->ChargeTimeInSeconds))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("%s: duplicate ranged projectile charge threshold %.2f, ignoring %s."),
+			       *GetNameSafe(Owner), Threshold, *GetNameSafe(Sorted[i]->ProjectileClass.Get()));
+			continue;
+		}
+		if (!Sorted[i]->ProjectileClass)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("%s: ranged projectile at charge threshold %.2f has no class."),
+			       *GetNameSafe(Owner), Threshold);
+		}
+		if (Classes.Num() >= NoProjectile)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("%s: too many ranged projectile entries, ignoring the rest."),
+			       *GetNameSafe(Owner));
+			break;
+		}
+		if (Threshold > MaxChargeSeconds)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("%s: ranged projectile charge threshold %.2f exceeds the %.0f second cap."),
+			       *GetNameSafe(Owner), Threshold, MaxChargeSeconds);
+			continue;
+		}
+
+		// A threshold applies from the first step at or after it
+		const int32 Step = FMath::Max(0, FMath::CeilToInt32(Threshold * StepsPerSecond));
+		const uint8 ClassIndex = static_cast<uint8>(Classes.Add(Sorted[i]->ProjectileClass));
+		for (int32 s = Step; s < NumSteps; ++s)
+		{
+			StepToClass[s] = ClassIndex;
+		}
+	}
+}
+
+TSubclassOf<ARCProjectile> FRCChargeProjectileTable::Find(float ChargeSeconds) const
+{
+	if (!bIsBuilt)
+	{
+		return nullptr;
+	}
+
+	const int32 Step = FMath::FloorToInt32(FMath::Clamp(ChargeSeconds, 0.f, MaxChargeSeconds) * StepsPerSecond);
+	const uint8 ClassIndex = StepToClass[Step];
+	return ClassIndex != NoProjectile ? Classes[ClassIndex] : nullptr;
+}
@@ -0,0 +1,42 @@
+// Copyright 2026 Michael DiLucca.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/SubclassOf.h"
+
+class ARCProjectile;
+struct FChargedProjectile;
+
+/**
+ * Dense charge-time to projectile lookup compiled from the designer-facing FChargedProjectile entries.
+ * Charge time is sampled in fixed steps so a lookup is a single index, and thresholds may be fractional.
+ * Each step resolves to the entry with the highest threshold not above that charge time.
+ */
+class FRCChargeProjectileTable
+{
+public:
+	static constexpr float MaxChargeSeconds = 10.f;
+	static constexpr int32 StepsPerSecond = 20;
+	static constexpr int32 NumSteps = static_cast<int32>(MaxChargeSeconds) * StepsPerSecond + 1;
+
+	/** Rebuild the table. Problems with the entries are logged here, once, instead of on every shot. */
+	void Build(const TArray<FChargedProjectile>& Entries, const UObject* Owner);
+
+	/** Projectile for the given charge time, clamped to [0, MaxChargeSeconds]. Null if no threshold is reached. */
+	TSubclassOf<ARCProjectile> Find(float ChargeSeconds) const;
+
+	bool IsBuilt() const { return bIsBuilt; }
+	bool IsEmpty() const { return Classes.IsEmpty(); }
+
+private:
+	static constexpr uint8 NoProjectile = MAX_uint8;
+
+	/** Distinct projectile classes, sorted by ascending threshold. */
+	TArray<TSubclassOf<ARCProjectile>, TInlineAllocator<4>> Classes;
+
+	/** Index into Classes for every charge step. */
+	uint8 StepToClass[NumSteps];
+
+	bool bIsBuilt = false;
+};
@@ -0,0 +1,32 @@
+// Copyright 2026 Michael DiLucca.
+
+#include "RCCombatReplication.h"
+
+bool FRCReplicatedCombatState::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	// [0..2] current equippable, [3..5] last equippable, [6..10] flags
+	uint32 Packed = 0;
+	if (Ar.IsSaving())
+	{
+		Packed = (CurrentEquippable & 0x7)
+			| (LastEquippable & 0x7) << EquippableBits
+			| (static_cast<uint32>(Flags) & 0x1F) << (EquippableBits * 2);
+	}
+
+	Ar.SerializeBits(&Packed, EquippableBits * 2 + FlagBits);
+
+	if (Ar.IsLoading())
+	{
+		CurrentEquippable = Packed & 0x7;
+		LastEquippable = (Packed >> EquippableBits) & 0x7;
+		Flags = static_cast<ERCCombatStateFlags>((Packed >> (EquippableBits * 2)) & 0x1F);
+	}
+
+	if (HasFlag(ERCCombatStateFlags::Charging))
+	{
+		Ar << ChargeStartFrame;
+	}
+
+	bOutSuccess = !Ar.IsError();
+	return true;
+}
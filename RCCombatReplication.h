@@ -0,0 +1,69 @@
+// Copyright 2026 Michael DiLucca.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RCCombatReplication.generated.h"
+
+/** Combat flags carried in FRCReplicatedCombatState. */
+enum class ERCCombatStateFlags : uint8
+{
+	None = 0,
+	Shielding = 1 << 0,
+	Shooting = 1 << 1,
+	Meleeing = 1 << 2,
+	Invincible = 1 << 3,
+	Charging = 1 << 4,
+};
+ENUM_CLASS_FLAGS(ERCCombatStateFlags);
+
+/**
+ * Everything simulated proxies need to show a character's combat state, packed by NetSerialize into
+ * 11 bits, plus 16 while a ranged charge is held. Property replication only sends it when it changes.
+ */
+USTRUCT()
+struct FRCReplicatedCombatState
+{
+	GENERATED_BODY()
+
+	static constexpr uint32 EquippableBits = 3;
+	static constexpr uint32 FlagBits = 5;
+
+	/** EEquippable values. */
+	uint8 CurrentEquippable = 0;
+	uint8 LastEquippable = 0;
+
+	ERCCombatStateFlags Flags = ERCCombatStateFlags::None;
+
+	/** Low 16 bits of the server gameplay frame the charge started on. Only sent while Charging. */
+	uint16 ChargeStartFrame = 0;
+
+	bool HasFlag(ERCCombatStateFlags Flag) const { return EnumHasAnyFlags(Flags, Flag); }
+	void SetFlag(ERCCombatStateFlags Flag, bool bSet) { bSet ? EnumAddFlags(Flags, Flag) : EnumRemoveFlags(Flags, Flag); }
+
+	/** Frames since the charge started, given the server's current gameplay frame. Handles the 16 bit wrap. */
+	int32 GetFramesCharging(int32 ServerFrame) const
+	{
+		return static_cast<uint16>(static_cast<uint16>(ServerFrame) - ChargeStartFrame);
+	}
+
+	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+
+	bool operator==(const FRCReplicatedCombatState& Other) const
+	{
+		return CurrentEquippable == Other.CurrentEquippable
+			&& LastEquippable == Other.LastEquippable
+			&& Flags == Other.Flags
+			&& (!HasFlag(ERCCombatStateFlags::Charging) || ChargeStartFrame == Other.ChargeStartFrame);
+	}
+};
+
+template <>
+struct TStructOpsTypeTraits<FRCReplicatedCombatState> : public TStructOpsTypeTraitsBase2<FRCReplicatedCombatState>
+{
+	enum
+	{
+		WithNetSerializer = true,
+		WithIdenticalViaEquality = true,
+	};
+};
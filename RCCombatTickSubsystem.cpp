@@ -0,0 +1,111 @@
+// Copyright 2026 Michael DiLucca.
+
+#include "RCCombatTickSubsystem.h"
+
+#include "RCCharacter.h"
+#include "RCGameplayTimers.h"
+#include "Async/ParallelFor.h"
+#include "Engine/World.h"
+
+int32 URCCombatTickSubsystem::Register(ARCCharacter* Character)
+{
+	int32 Slot;
+	if (!FreeSlots.IsEmpty())
+	{
+		Slot = FreeSlots.Pop(EAllowShrinking::No);
+		Characters[Slot] = Character;
+	}
+	else
+	{
+		Slot = Characters.Add(Character);
+		EquipReadyFrames.AddDefaulted();
+		NextDeadlineFrames.AddDefaulted();
+		NextInputExpireFrames.AddDefaulted();
+		HasBufferedInput.AddDefaulted();
+		HasPendingWork.AddDefaulted();
+		IsDue.AddDefaulted();
+	}
+	SetTickState(Slot, FRCCombatTickState());
+	++NumRegistered;
+	return Slot;
+}
+
+void URCCombatTickSubsystem::Unregister(int32 Slot)
+{
+	if (!Characters.IsValidIndex(Slot) || !Characters[Slot]) return;
+
+	SetTickState(Slot, FRCCombatTickState());
+	Characters[Slot] = nullptr;
+	FreeSlots.Add(Slot);
+	--NumRegistered;
+}
+
+void URCCombatTickSubsystem::SetTickState(int32 Slot, const FRCCombatTickState& State)
+{
+	if (!Characters.IsValidIndex(Slot)) return;
+
+	NumPending += static_cast<int32>(State.bHasPendingWork) - static_cast<int32>(HasPendingWork[Slot]);
+	EquipReadyFrames[Slot] = State.EquipReadyFrame;
+	NextDeadlineFrames[Slot] = State.NextDeadlineFrame;
+	NextInputExpireFrames[Slot] = State.NextInputExpireFrame;
+	HasBufferedInput[Slot] = State.bHasBufferedInput;
+	HasPendingWork[Slot] = State.bHasPendingWork;
+}
+
+void URCCombatTickSubsystem::Tick(float DeltaTime)
+{
+	const int32 CurrentFrame = FRCGameplayTimers::GetFrame(GetWorld());
+
+	// Decide who has a deadline, an expiry or resolvable input this frame, one pass over contiguous arrays
+	const int32 NumSlots = Characters.Num();
+	const int32* RESTRICT EquipReady = EquipReadyFrames.GetData();
+	const int32* RESTRICT NextDeadline = NextDeadlineFrames.GetData();
+	const int32* RESTRICT NextExpire = NextInputExpireFrames.GetData();
+	const uint8* RESTRICT Buffered = HasBufferedInput.GetData();
+	const uint8* RESTRICT Pending = HasPendingWork.GetData();
+	uint8* RESTRICT Due = IsDue.GetData();
+	ParallelFor(NumSlots, [EquipReady, NextDeadline, NextExpire, Buffered, Pending, Due, CurrentFrame](int32 i)
+	{
+		Due[i] = Pending[i] && (NextDeadline[i] <= CurrentFrame
+			|| NextExpire[i] < CurrentFrame
+			|| (Buffered[i] && EquipReady[i] < CurrentFrame));
+	}, NumSlots < MinParallelBatchSize);
+
+	// Dispatch on the game thread, each character pushes its new timing from TickCombat.
+	// Slots registered during dispatch are past NumSlots and wait for next frame.
+	for (int32 Slot = 0; Slot < NumSlots; ++Slot)
+	{
+		if (!IsDue[Slot]) continue;
+
+		if (ARCCharacter* Character = Characters[Slot]; IsValid(Character))
+		{
+			Character->TickCombat(CurrentFrame);
+		}
+	}
+}
+
+TStatId URCCombatTickSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(URCCombatTickSubsystem, STATGROUP_Tickables);
+}
+
+void URCCombatTickSubsystem::Deinitialize()
+{
+	Characters.Empty();
+	EquipReadyFrames.Empty();
+	NextDeadlineFrames.Empty();
+	NextInputExpireFrames.Empty();
+	HasBufferedInput.Empty();
+	HasPendingWork.Empty();
+	IsDue.Empty();
+	FreeSlots.Empty();
+	NumRegistered = 0;
+	NumPending = 0;
+
+	Super::Deinitialize();
+}
+
+bool URCCombatTickSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
@@ -0,0 +1,69 @@
+// Copyright 2026 Michael DiLucca.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "RCCombatTickSubsystem.generated.h"
+
+class ARCCharacter;
+
+/** Combat timing a character pushes to the combat tick whenever it schedules new work. */
+struct FRCCombatTickState
+{
+	int32 EquipReadyFrame = 0;
+	int32 NextDeadlineFrame = MAX_int32;
+	int32 NextInputExpireFrame = MAX_int32;
+	bool bHasBufferedInput = false;
+	bool bHasPendingWork = false;
+};
+
+/**
+ * Replaces per-character ticking for characters that opt in with bUseBatchedCombatTick.
+ * Characters push their combat timing into contiguous per-slot arrays when they buffer input or set a deadline,
+ * and again after each combat tick. Every frame one pass over those arrays finds the characters with something
+ * due, and only those are called back, on the game thread.
+ * Timing that has since moved later or been cleared, e.g. by input consumed straight from a handler, is left as
+ * pushed: it only makes a character due early, and its combat tick then pushes the current timing.
+ */
+UCLASS()
+class URCCombatTickSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Add a character and return its slot, which stays valid until it is unregistered. */
+	int32 Register(ARCCharacter* Character);
+	void Unregister(int32 Slot);
+
+	/** Replace the combat timing of the character in Slot. */
+	void SetTickState(int32 Slot, const FRCCombatTickState& State);
+
+	int32 GetNumRegistered() const { return NumRegistered; }
+	int32 GetNumPending() const { return NumPending; }
+
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return NumPending > 0; }
+	virtual TStatId GetStatId() const override;
+	virtual void Deinitialize() override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/** Below this many slots the due pass runs inline, the task overhead outweighs the work. */
+	static constexpr int32 MinParallelBatchSize = 256;
+
+	// Per slot, stable while registered
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<ARCCharacter>> Characters;
+	TArray<int32> EquipReadyFrames;
+	TArray<int32> NextDeadlineFrames;
+	TArray<int32> NextInputExpireFrames;
+	TArray<uint8> HasBufferedInput;
+	TArray<uint8> HasPendingWork;
+	TArray<uint8> IsDue;
+	TArray<int32> FreeSlots;
+	int32 NumRegistered = 0;
+	int32 NumPending = 0;
+};
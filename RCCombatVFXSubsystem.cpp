@@ -0,0 +1,70 @@
+// Copyright 2026 Michael DiLucca.
+
+#include "RCCombatVFXSubsystem.h"
+
+#include "RCCharacterStats.h"
+#include "RCCombatVFXTable.h"
+#include "NiagaraComponent.h"
+#include "NiagaraFunctionLibrary.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Combat VFX Played"), STAT_RCCombatVFXPlayed, STATGROUP_RCCharacter);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Combat VFX Culled"), STAT_RCCombatVFXCulled, STATGROUP_RCCharacter);
+
+UNiagaraComponent* URCCombatVFXSubsystem::Play(const FRCCombatVFXEntry& Entry, USkeletalMeshComponent* Mesh)
+{
+	if (!Entry.System || !Mesh) return nullptr;
+
+	const FTransform SocketTransform = Mesh->GetSocketTransform(Entry.Socket);
+	const FVector Location = SocketTransform.TransformPosition(Entry.Offset);
+	if (Entry.CullDistance > 0.f && !IsInViewRange(Location, Entry.CullDistance))
+	{
+		INC_DWORD_STAT(STAT_RCCombatVFXCulled);
+		return nullptr;
+	}
+
+	INC_DWORD_STAT(STAT_RCCombatVFXPlayed);
+	if (Entry.bAttachToSocket)
+	{
+		return UNiagaraFunctionLibrary::SpawnSystemAttached(Entry.System, Mesh, Entry.Socket, Entry.Offset,
+		                                                    FRotator::ZeroRotator, EAttachLocation::KeepRelativeOffset,
+		                                                    false, true, ENCPoolMethod::AutoRelease);
+	}
+	return UNiagaraFunctionLibrary::SpawnSystemAtLocation(this, Entry.System, Location, SocketTransform.Rotator(),
+	                                                      FVector::OneVector, false, true, ENCPoolMethod::AutoRelease);
+}
+
+bool URCCombatVFXSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+bool URCCombatVFXSubsystem::IsInViewRange(const FVector& Location, float CullDistance)
+{
+	if (ViewLocationsFrame != GFrameCounter)
+	{
+		ViewLocationsFrame = GFrameCounter;
+		ViewLocations.Reset();
+		for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+		{
+			const APlayerController* PlayerController = It->Get();
+			if (PlayerController && PlayerController->IsLocalController() && PlayerController->PlayerCameraManager)
+			{
+				ViewLocations.Add(PlayerController->PlayerCameraManager->GetCameraLocation());
+			}
+		}
+	}
+
+	const double CullDistanceSquared = FMath::Square(static_cast<double>(CullDistance));
+	for (const FVector& ViewLocation : ViewLocations)
+	{
+		if (FVector::DistSquared(ViewLocation, Location) <= CullDistanceSquared)
+		{
+			return true;
+		}
+	}
+	return false;
+}
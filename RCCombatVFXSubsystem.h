@@ -0,0 +1,36 @@
+// Copyright 2026 Michael DiLucca.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "RCCombatVFXSubsystem.generated.h"
+
+class UNiagaraComponent;
+class USkeletalMeshComponent;
+struct FRCCombatVFXEntry;
+
+/**
+ * Plays combat effects from a URCCombatVFXTable through Niagara's component pool.
+ * Effects further than their cull distance from every local view are skipped before anything is spawned,
+ * so worlds without local players, e.g. dedicated servers, never spawn combat effects.
+ */
+UCLASS()
+class URCCombatVFXSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Play Entry at its socket on Mesh. Returns the pooled component, or null if culled. */
+	UNiagaraComponent* Play(const FRCCombatVFXEntry& Entry, USkeletalMeshComponent* Mesh);
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	bool IsInViewRange(const FVector& Location, float CullDistance);
+
+	/** Local view locations, gathered once per frame on first use. */
+	TArray<FVector, TInlineAllocator<4>> ViewLocations;
+	uint64 ViewLocationsFrame = MAX_uint64;
+};
@@ -0,0 +1,66 @@
+// Copyright 2026 Michael DiLucca.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "RCCombatVFXTable.generated.h"
+
+class UNiagaraSystem;
+
+/** Combat events that play an effect, one per Play*VFX Blueprint event on ARCCharacter. */
+UENUM(BlueprintType)
+enum class ERCCombatVFX : uint8
+{
+	TriggerRangedSuccess,
+	FireRangedSuccess,
+	ReleaseRangedSuccess,
+	ReleaseRangedFailure,
+	MeleeSuccess,
+	ShieldSuccess,
+	HealFinish,
+
+	Count UMETA(Hidden)
+};
+
+/** How a combat event's effect is played. */
+USTRUCT(BlueprintType)
+struct FRCCombatVFXEntry
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "VFX")
+	TObjectPtr<UNiagaraSystem> System;
+
+	/** Socket on the character mesh the effect plays at. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "VFX")
+	FName Socket = NAME_None;
+
+	/** Offset from the socket, in the socket's space. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "VFX")
+	FVector Offset = FVector::ZeroVector;
+
+	/** Follow the socket while playing, otherwise the effect stays where it started. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "VFX")
+	bool bAttachToSocket = true;
+
+	/** Not played when further than this from every local view. 0 never culls. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "VFX", meta = (ClampMin = "0", Units = "cm"))
+	float CullDistance = 5000.f;
+};
+
+/**
+ * Maps combat events to pooled Niagara systems for URCCombatVFXSubsystem.
+ * Events without an entry keep going to the character's Blueprint Play*VFX event.
+ */
+UCLASS(BlueprintType)
+class URCCombatVFXTable : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	const FRCCombatVFXEntry* Find(ERCCombatVFX Event) const { return Entries.Find(Event); }
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "VFX")
+	TMap<ERCCombatVFX, FRCCombatVFXEntry> Entries;
+};
@@ -0,0 +1,239 @@
+// Copyright 2026 Michael DiLucca.
+
+#include "RCCrowdBenchmarkCommandlet.h"
+
+#include "RCCharacter.h"
+#include "RCCharacterStats.h"
+#include "RCGameplayTimers.h"
+#include "RCHeadlessWorld.h"
+#include "RCInputRecording.h"
+#include "Engine/World.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "ProfilingDebugging/TraceAuxiliary.h"
+
+namespace RCCrowdBenchmark
+{
+	struct FResult
+	{
+		int32 Count = 0;
+		int32 Frames = 0;
+		double FrameMeanMs = 0;
+		double FrameP95Ms = 0;
+		double FrameMaxMs = 0;
+		double MemoryPerCharacterKB = 0;
+	};
+
+	/** Length of one scripted combat loop, in frames. */
+	static constexpr uint32 ScriptLength = 4 * FRCGameplayTimers::FramesPerSecond;
+
+	/** Feed the scripted input for this point of a character's combat loop. */
+	static void DriveCharacter(ARCCharacter* Character, uint32 ScriptFrame)
+	{
+		auto Send = [Character](ERCRecordedAction Action, ETriggerEvent TriggerEvent, float Value = 1.f)
+		{
+			FRCRecordedInput Input;
+			Input.Action = Action;
+			Input.TriggerEvent = TriggerEvent;
+			Input.SetValue(Value);
+			Character->ReplayRecordedInput(Input);
+		};
+
+		// Pace back and forth over each loop
+		Send(ERCRecordedAction::Move, ETriggerEvent::Triggered, ScriptFrame < ScriptLength / 2 ? 1.f : -1.f);
+
+		switch (ScriptFrame)
+		{
+		case 0: Send(ERCRecordedAction::Ranged, ETriggerEvent::Started); break;
+		case 90: Send(ERCRecordedAction::Ranged, ETriggerEvent::Completed); break;
+		case 100: Send(ERCRecordedAction::Melee, ETriggerEvent::Started); break;
+		case 110: Send(ERCRecordedAction::Melee, ETriggerEvent::Completed); break;
+		case 130: Send(ERCRecordedAction::Shield, ETriggerEvent::Started); break;
+		case 170: Send(ERCRecordedAction::Shield, ETriggerEvent::Completed); break;
+		case 190: Send(ERCRecordedAction::Dash, ETriggerEvent::Triggered); break;
+		case 200: Send(ERCRecordedAction::Jump, ETriggerEvent::Triggered); break;
+		case 210: Send(ERCRecordedAction::Jump, ETriggerEvent::Completed); break;
+		default: break;
+		}
+	}
+
+	static bool RunCrowd(UClass* CharacterClass, int32 Count, int32 WarmupFrames, int32 Frames,
+	                     const FString& TracePath, FResult& OutResult)
+	{
+		FRCHeadlessWorld HeadlessWorld(TEXT("RCCrowdBenchmark"));
+
+		const uint64 MemoryBefore = FPlatformMemory::GetStats().UsedPhysical;
+		TArray<ARCCharacter*> Characters;
+		Characters.Reserve(Count);
+		for (int32 i = 0; i < Count; ++i)
+		{
+			// A single line along the gameplay plane so projectiles and melee find neighbours. Possessed, so the
+			// scripted movement, jumps and dashes run through the movement component.
+			ARCCharacter* Character = Cast<ARCCharacter>(
+				HeadlessWorld.SpawnPossessedPawn(CharacterClass, FVector(i * 300.f, 0, 200)));
+			if (!Character)
+			{
+				UE_LOG(LogTemp, Error, TEXT("Could not spawn %s"), *GetNameSafe(CharacterClass));
+				return false;
+			}
+			Characters.Add(Character);
+		}
+		const uint64 MemoryAfter = FPlatformMemory::GetStats().UsedPhysical;
+
+		const float DeltaSeconds = 1.f / FRCGameplayTimers::FramesPerSecond;
+		TArray<double> FrameMs;
+		FrameMs.Reserve(Frames);
+
+		for (int32 Frame = 0; Frame < WarmupFrames + Frames; ++Frame)
+		{
+			const bool bMeasuring = Frame >= WarmupFrames;
+#if RC_CHARACTER_TRACE_ENABLED
+			// The per-path split comes from the RC_CHARACTER_SCOPE events in the trace
+			if (Frame == WarmupFrames && !TracePath.IsEmpty())
+			{
+				FTraceAuxiliary::Start(FTraceAuxiliary::EConnectionType::File, *TracePath, TEXT("cpu,rccharacter"));
+			}
+#endif
+
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			for (int32 i = 0; i < Characters.Num(); ++i)
+			{
+				// Stagger the script so the crowd isn't acting in lockstep
+				if (IsValid(Characters[i]))
+				{
+					DriveCharacter(Characters[i], (Frame + i * 7) % ScriptLength);
+				}
+			}
+			HeadlessWorld.Tick(DeltaSeconds);
+
+			if (bMeasuring)
+			{
+				FrameMs.Add(FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles));
+			}
+		}
+#if RC_CHARACTER_TRACE_ENABLED
+		if (!TracePath.IsEmpty())
+		{
+			FTraceAuxiliary::Stop();
+		}
+#endif
+
+		FrameMs.Sort();
+		double TotalMs = 0;
+		for (const double Ms : FrameMs)
+		{
+			TotalMs += Ms;
+		}
+
+		OutResult.Count = Count;
+		OutResult.Frames = Frames;
+		OutResult.FrameMeanMs = TotalMs / FMath::Max(Frames, 1);
+		OutResult.FrameP95Ms = FrameMs.IsEmpty() ? 0 : FrameMs[FMath::Min(FrameMs.Num() - 1, FrameMs.Num() * 95 / 100)];
+		OutResult.FrameMaxMs = FrameMs.IsEmpty() ? 0 : FrameMs.Last();
+		OutResult.MemoryPerCharacterKB = MemoryAfter > MemoryBefore
+			                                 ? (MemoryAfter - MemoryBefore) / 1024.0 / FMath::Max(Count, 1)
+			                                 : 0;
+		return true;
+	}
+
+	static FString ToCsv(const TArray<FResult>& Results)
+	{
+		FString Csv = TEXT("Count,Frames,FrameMeanMs,FrameP95Ms,FrameMaxMs,MemoryPerCharacterKB\n");
+
+		for (const FResult& Result : Results)
+		{
+			Csv += FString::Printf(TEXT("%d,%d,%.4f,%.4f,%.4f,%.2f\n"), Result.Count, Result.Frames, Result.FrameMeanMs,
+			                       Result.FrameP95Ms, Result.FrameMaxMs, Result.MemoryPerCharacterKB);
+		}
+		return Csv;
+	}
+
+	static FString ToJson(const TArray<FResult>& Results)
+	{
+		FString Json = TEXT("[\n");
+		for (int32 i = 0; i < Results.Num(); ++i)
+		{
+			const FResult& Result = Results[i];
+			Json += FString::Printf(TEXT("  {\"count\": %d, \"frames\": %d, \"frameMeanMs\": %.4f, ")
+			                        TEXT("\"frameP95Ms\": %.4f, \"frameMaxMs\": %.4f, \"memoryPerCharacterKB\": %.2f}%s\n"),
+			                        Result.Count, Result.Frames, Result.FrameMeanMs, Result.FrameP95Ms,
+			                        Result.FrameMaxMs, Result.MemoryPerCharacterKB,
+			                        i + 1 < Results.Num() ? TEXT(",") : TEXT(""));
+		}
+		Json += TEXT("]\n");
+		return Json;
+	}
+}
+
+URCCrowdBenchmarkCommandlet::URCCrowdBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 URCCrowdBenchmarkCommandlet::Main(const FString& Params)
+{
+	using namespace RCCrowdBenchmark;
+
+	FString CountsParam = TEXT("10,100,500,2000");
+	FParse::Value(*Params, TEXT("Counts="), CountsParam);
+	TArray<FString> CountStrings;
+	CountsParam.ParseIntoArray(CountStrings, TEXT(","));
+
+	int32 Frames = 10 * FRCGameplayTimers::FramesPerSecond;
+	FParse::Value(*Params, TEXT("Frames="), Frames);
+	int32 WarmupFrames = FRCGameplayTimers::FramesPerSecond;
+	FParse::Value(*Params, TEXT("WarmupFrames="), WarmupFrames);
+
+	UClass* CharacterClass = ARCCharacter::StaticClass();
+	FString CharacterClassPath;
+	if (FParse::Value(*Params, TEXT("Character="), CharacterClassPath))
+	{
+		CharacterClass = LoadClass<ARCCharacter>(nullptr, *CharacterClassPath);
+		if (!CharacterClass)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Could not load character class %s"), *CharacterClassPath);
+			return 1;
+		}
+	}
+
+	FString OutputPath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Benchmarks"), TEXT("RCCrowdBenchmark.csv"));
+	FParse::Value(*Params, TEXT("Output="), OutputPath);
+
+	const bool bTrace = FParse::Param(*Params, TEXT("TraceSections"));
+
+	TArray<FResult> Results;
+	for (const FString& CountString : CountStrings)
+	{
+		const int32 Count = FCString::Atoi(*CountString);
+		if (Count <= 0) continue;
+
+		const FString TracePath = bTrace
+			                          ? FPaths::Combine(FPaths::GetPath(OutputPath),
+			                                            FString::Printf(TEXT("RCCrowdBenchmark_%d.utrace"), Count))
+			                          : FString();
+
+		FResult& Result = Results.AddDefaulted_GetRef();
+		if (!RunCrowd(CharacterClass, Count, WarmupFrames, Frames, TracePath, Result))
+		{
+			return 1;
+		}
+
+		UE_LOG(LogTemp, Display, TEXT("%5d characters: mean %.3f ms, p95 %.3f ms, max %.3f ms, %.1f KB per character"),
+		       Result.Count, Result.FrameMeanMs, Result.FrameP95Ms, Result.FrameMaxMs, Result.MemoryPerCharacterKB);
+	}
+
+	const bool bJson = FPaths::GetExtension(OutputPath).Equals(TEXT("json"), ESearchCase::IgnoreCase);
+	if (!FFileHelper::SaveStringToFile(bJson ? ToJson(Results) : ToCsv(Results), *OutputPath))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Could not write %s"), *OutputPath);
+		return 1;
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("Crowd benchmark results written to %s"), *OutputPath);
+	return 0;
+}
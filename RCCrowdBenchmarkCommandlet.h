@@ -0,0 +1,27 @@
+// Copyright 2026 Michael DiLucca.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "RCCrowdBenchmarkCommandlet.generated.h"
+
+/**
+ * Spawns crowds of characters in a headless world, drives them through scripted combat (charged shots, melee,
+ * shield swaps, dashes) and reports game-thread cost per frame plus memory per character. One result row per
+ * crowd size. With -TraceSections the measured frames of each crowd are also traced, with the RCCharacter channel,
+ * to RCCrowdBenchmark_<Count>.utrace next to the output; open it in Unreal Insights for the split by code path.
+ *
+ * UnrealEditor-Cmd <Project> -run=RCCrowdBenchmark -nullrhi [-Counts=10,100,500,2000] [-Frames=<n>]
+ *     [-WarmupFrames=<n>] [-Character=<class path>] [-Output=<file.csv|file.json>] [-TraceSections]
+ */
+UCLASS()
+class URCCrowdBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	URCCrowdBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,75 @@
+// Copyright 2026 Michael DiLucca.
+
+#include "RCDamageBatchSubsystem.h"
+
+#include "RCCharacter.h"
+#include "Engine/World.h"
+
+void FRCDamageBatchTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread,
+                                             const FGraphEventRef& MyCompletionGraphEvent)
+{
+	if (Subsystem)
+	{
+		Subsystem->Flush();
+	}
+}
+
+FString FRCDamageBatchTickFunction::DiagnosticMessage()
+{
+	return TEXT("FRCDamageBatchTickFunction");
+}
+
+void URCDamageBatchSubsystem::QueueCharacter(ARCCharacter* Character)
+{
+	QueuedCharacters.Add(Character);
+	if (TickFunction.IsTickFunctionRegistered())
+	{
+		TickFunction.SetTickFunctionEnable(true);
+	}
+}
+
+void URCDamageBatchSubsystem::Flush()
+{
+	// Damage resolved here may queue more (e.g. on death), that is picked up next frame
+	Swap(ResolvingCharacters, QueuedCharacters);
+	for (const TWeakObjectPtr<ARCCharacter>& Character : ResolvingCharacters)
+	{
+		if (Character.IsValid())
+		{
+			Character->ResolvePendingDamage();
+		}
+	}
+	ResolvingCharacters.Reset();
+
+	if (QueuedCharacters.IsEmpty())
+	{
+		TickFunction.SetTickFunctionEnable(false);
+	}
+}
+
+void URCDamageBatchSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	TickFunction.bCanEverTick = true;
+	TickFunction.bStartWithTickEnabled = !QueuedCharacters.IsEmpty();
+	TickFunction.TickGroup = TG_PostUpdateWork;
+	TickFunction.Subsystem = this;
+	TickFunction.RegisterTickFunction(InWorld.PersistentLevel);
+}
+
+void URCDamageBatchSubsystem::Deinitialize()
+{
+	if (TickFunction.IsTickFunctionRegistered())
+	{
+		TickFunction.UnRegisterTickFunction();
+	}
+	QueuedCharacters.Empty();
+
+	Super::Deinitialize();
+}
+
+bool URCDamageBatchSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
@@ -0,0 +1,62 @@
+// Copyright 2026 Michael DiLucca.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineBaseTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "RCDamageBatchSubsystem.generated.h"
+
+class ARCCharacter;
+class URCDamageBatchSubsystem;
+
+/** Late tick that resolves every character's queued damage for the frame. */
+USTRUCT()
+struct FRCDamageBatchTickFunction : public FTickFunction
+{
+	GENERATED_BODY()
+
+	URCDamageBatchSubsystem* Subsystem = nullptr;
+
+	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread,
+	                         const FGraphEventRef& MyCompletionGraphEvent) override;
+	virtual FString DiagnosticMessage() override;
+};
+
+template <>
+struct TStructOpsTypeTraits<FRCDamageBatchTickFunction> : public TStructOpsTypeTraitsBase2<FRCDamageBatchTickFunction>
+{
+	enum { WithCopy = false };
+};
+
+/**
+ * Collects characters that queued damage events during the frame and resolves each of them once in
+ * TG_PostUpdateWork, so health broadcasts and death are raised at most once per character per frame.
+ * The tick only runs on frames where something was queued.
+ */
+UCLASS()
+class URCDamageBatchSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Resolve this character's queued damage at the end of the frame. */
+	void QueueCharacter(ARCCharacter* Character);
+
+	/** Resolve every queued character now. */
+	void Flush();
+
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	FRCDamageBatchTickFunction TickFunction;
+
+	TArray<TWeakObjectPtr<ARCCharacter>> QueuedCharacters;
+
+	/** Characters being resolved, kept so a flush doesn't allocate. */
+	TArray<TWeakObjectPtr<ARCCharacter>> ResolvingCharacters;
+};
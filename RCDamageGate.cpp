@@ -0,0 +1,40 @@
+// Copyright 2026 Michael DiLucca.
+
+#include "RCDamageGate.h"
+
+bool FRCDamageGate::IsSourceOnCooldown(const UObject* Source, int32 CurrentFrame, int32 CooldownFrames)
+{
+	if (!Source) return false;
+
+	const FObjectKey SourceKey(Source);
+	int32 ReuseSlot = 0;
+	for (int32 Slot = 0; Slot < NumSourceSlots; ++Slot)
+	{
+		if (Sources[Slot] == SourceKey)
+		{
+			if (ReadyFrames[Slot] > CurrentFrame) return true;
+
+			ReadyFrames[Slot] = CurrentFrame + CooldownFrames;
+			return false;
+		}
+
+		if (ReadyFrames[Slot] < ReadyFrames[ReuseSlot])
+		{
+			ReuseSlot = Slot;
+		}
+	}
+
+	Sources[ReuseSlot] = SourceKey;
+	ReadyFrames[ReuseSlot] = CurrentFrame + CooldownFrames;
+	return false;
+}
+
+void FRCDamageGate::Reset()
+{
+	for (int32 Slot = 0; Slot < NumSourceSlots; ++Slot)
+	{
+		Sources[Slot] = FObjectKey();
+		ReadyFrames[Slot] = 0;
+	}
+	bIsDead = false;
+}
@@ -0,0 +1,30 @@
+// Copyright 2026 Michael DiLucca.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+/**
+ * Cheap pre-filter state for incoming damage: whether the owner is dead, and a small fixed-size table of
+ * per-source re-hit cooldowns. Sources are keyed by FObjectKey so a destroyed source never aliases a new one.
+ * When the table is full, the slot whose cooldown ends first is reused.
+ */
+class FRCDamageGate
+{
+public:
+	static constexpr int32 NumSourceSlots = 8;
+
+	void SetIsDead(bool bNewIsDead) { bIsDead = bNewIsDead; }
+	bool IsDead() const { return bIsDead; }
+
+	/** True if Source hit within its cooldown, in gameplay frames. Otherwise records the hit, starting a new cooldown, and returns false. */
+	bool IsSourceOnCooldown(const UObject* Source, int32 CurrentFrame, int32 CooldownFrames);
+
+	void Reset();
+
+private:
+	FObjectKey Sources[NumSourceSlots];
+	int32 ReadyFrames[NumSourceSlots] = {};
+	bool bIsDead = false;
+};
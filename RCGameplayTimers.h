@@ -0,0 +1,127 @@
+// Copyright 2026 Michael DiLucca.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/World.h"
+
+/** Gameplay deadlines a character can be waiting on. */
+enum class ERCGameplayDeadline : uint8
+{
+	IFrames,
+	Coyote,
+	DeathMontage,
+
+	Count
+};
+
+/**
+ * When an input took effect, as world time and the gameplay frame it counts for.
+ * The frame is kept alongside the time so gates never depend on rounding the time back to a frame.
+ */
+struct FRCInputEventTime
+{
+	double Seconds = -1.0;
+	int32 Frame = 0;
+
+	bool IsSet() const { return Seconds >= 0.0; }
+};
+
+/**
+ * Per-character gameplay timing kept as integer frame counts of a fixed simulation step.
+ * Frames are derived from world time, so they advance deterministically with the world, pause with it and
+ * never drift in long sessions. Deadlines are checked by the owner's tick instead of the timer manager.
+ */
+struct FRCGameplayTimers
+{
+	static constexpr int32 FramesPerSecond = 60;
+
+	/** A frame far enough in the past that any delay has elapsed, without overflowing when added to. */
+	static constexpr int32 NeverFrame = MIN_int32 / 2;
+
+	/** Current simulation frame of the world. */
+	static int32 GetFrame(const UWorld* World)
+	{
+		return TimeToFrame(World->GetTimeSeconds());
+	}
+
+	static int32 TimeToFrame(double TimeSeconds)
+	{
+		return FMath::FloorToInt32(TimeSeconds * FramesPerSecond);
+	}
+
+	/** Whole frames needed to cover a duration, rounded up so a delay is never shortened. */
+	static int32 SecondsToFrames(float Seconds)
+	{
+		return FMath::CeilToInt32(Seconds * FramesPerSecond);
+	}
+
+	static float FramesToSeconds(int32 Frames)
+	{
+		return static_cast<float>(Frames) / FramesPerSecond;
+	}
+
+	/** World time at which Frame starts. */
+	static double FrameToTime(int32 Frame)
+	{
+		return static_cast<double>(Frame) / FramesPerSecond;
+	}
+
+	void SetDeadline(ERCGameplayDeadline Deadline, int32 Frame)
+	{
+		Deadlines[static_cast<int32>(Deadline)] = Frame;
+		PendingMask |= ToBit(Deadline);
+	}
+
+	void ClearDeadline(ERCGameplayDeadline Deadline) { PendingMask &= ~ToBit(Deadline); }
+	bool IsPending(ERCGameplayDeadline Deadline) const { return (PendingMask & ToBit(Deadline)) != 0; }
+	bool HasPendingDeadlines() const { return PendingMask != 0; }
+
+	/** Earliest pending deadline frame, MAX_int32 when nothing is pending. */
+	int32 GetNextDeadlineFrame() const
+	{
+		int32 NextFrame = MAX_int32;
+		for (int32 Index = 0; Index < static_cast<int32>(ERCGameplayDeadline::Count); ++Index)
+		{
+			if (IsPending(static_cast<ERCGameplayDeadline>(Index)))
+			{
+				NextFrame = FMath::Min(NextFrame, Deadlines[Index]);
+			}
+		}
+		return NextFrame;
+	}
+
+	/** Clear every deadline at or before Frame and return them as a mask of ERCGameplayDeadline bits. */
+	uint8 PopExpired(int32 Frame)
+	{
+		uint8 ExpiredMask = 0;
+		for (int32 Index = 0; Index < static_cast<int32>(ERCGameplayDeadline::Count); ++Index)
+		{
+			const ERCGameplayDeadline Deadline = static_cast<ERCGameplayDeadline>(Index);
+			if (IsPending(Deadline) && Deadlines[Index] <= Frame)
+			{
+				ExpiredMask |= ToBit(Deadline);
+			}
+		}
+		PendingMask &= ~ExpiredMask;
+		return ExpiredMask;
+	}
+
+	void Reset()
+	{
+		PendingMask = 0;
+		LastEquipFrame = NeverFrame;
+		LastMeleeAttackFrame = NeverFrame;
+		LastRangedAttackFrame = NeverFrame;
+	}
+
+	static uint8 ToBit(ERCGameplayDeadline Deadline) { return static_cast<uint8>(1u << static_cast<uint8>(Deadline)); }
+
+	int32 LastEquipFrame = NeverFrame;
+	int32 LastMeleeAttackFrame = NeverFrame;
+	int32 LastRangedAttackFrame = NeverFrame;
+
+private:
+	int32 Deadlines[static_cast<int32>(ERCGameplayDeadline::Count)] = {};
+	uint8 PendingMask = 0;
+};
@@ -0,0 +1,80 @@
+// Copyright 2026 Michael DiLucca.
+
+#include "RCHeadlessWorld.h"
+
+#include "Engine/Engine.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Engine/World.h"
+#include "Components/StaticMeshComponent.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/WorldSettings.h"
+
+FRCHeadlessWorld::FRCHeadlessWorld(const TCHAR* WorldName)
+{
+	World = UWorld::CreateWorld(EWorldType::Game, false, WorldName);
+	World->AddToRoot();
+
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+
+	World->InitializeActorsForPlay(FURL());
+	SpawnFloor();
+	World->BeginPlay();
+
+	// Without a game mode nothing dispatches BeginPlay to actors, do it through the world settings
+	if (!World->GetBegunPlay())
+	{
+		World->GetWorldSettings()->NotifyBeginPlay();
+	}
+}
+
+FRCHeadlessWorld::~FRCHeadlessWorld()
+{
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+	World->RemoveFromRoot();
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+}
+
+void FRCHeadlessWorld::Tick(float DeltaSeconds)
+{
+	World->Tick(LEVELTICK_All, DeltaSeconds);
+	GFrameCounter++;
+}
+
+APawn* FRCHeadlessWorld::SpawnPossessedPawn(UClass* PawnClass, const FVector& Location) const
+{
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	APawn* Pawn = World->SpawnActor<APawn>(PawnClass, Location, FRotator::ZeroRotator, SpawnParameters);
+	if (!Pawn) return nullptr;
+
+	// Without a game mode nothing possesses spawned pawns
+	Pawn->SpawnDefaultController();
+	if (!Pawn->GetController())
+	{
+		if (const ACharacter* Character = Cast<ACharacter>(Pawn))
+		{
+			Character->GetCharacterMovement()->bRunPhysicsWithNoController = true;
+		}
+	}
+	return Pawn;
+}
+
+void FRCHeadlessWorld::SpawnFloor()
+{
+	UStaticMesh* Cube = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
+	if (!Cube)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Headless world has no floor, characters will fall."));
+		return;
+	}
+
+	// A long, thin slab along the X/Z gameplay plane with its top at Z = 0
+	AStaticMeshActor* Floor = World->SpawnActor<AStaticMeshActor>(FVector(0, 0, -50), FRotator::ZeroRotator);
+	Floor->SetMobility(EComponentMobility::Movable);
+	Floor->GetStaticMeshComponent()->SetStaticMesh(Cube);
+	Floor->SetActorScale3D(FVector(2000, 20, 1));
+}
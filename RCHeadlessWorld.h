@@ -0,0 +1,38 @@
+// Copyright 2026 Michael DiLucca.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class APawn;
+class UWorld;
+
+/**
+ * A bare game world for benchmarks, with a floor to stand on and play already begun.
+ * Runs without a game mode, viewport or renderer, so it works under -nullrhi on a build machine.
+ */
+class FRCHeadlessWorld
+{
+public:
+	explicit FRCHeadlessWorld(const TCHAR* WorldName);
+	~FRCHeadlessWorld();
+
+	UE_NONCOPYABLE(FRCHeadlessWorld);
+
+	UWorld* Get() const { return World; }
+
+	/** Advance the world by one frame. */
+	void Tick(float DeltaSeconds);
+
+	/**
+	 * Spawn a pawn and possess it with its default controller, as a game mode would.
+	 * Character movement only consumes input on controlled pawns; without a controller class the pawn's
+	 * character movement is set to run without one instead.
+	 */
+	APawn* SpawnPossessedPawn(UClass* PawnClass, const FVector& Location) const;
+
+private:
+	void SpawnFloor();
+
+	UWorld* World = nullptr;
+};
@@ -0,0 +1,40 @@
+// Copyright 2026 Michael DiLucca.
+
+#include "RCInputBuffer.h"
+
+void FRCInputBuffer::Push(ERCBufferedInput Action, int32 CurrentFrame, double CurrentTime, int32 LifetimeFrames)
+{
+	FRCBufferedInput& Entry = Entries[static_cast<int32>(Action)];
+	Entry.BufferedFrame = CurrentFrame;
+	Entry.BufferedTime = CurrentTime;
+	Entry.ExpireFrame = LifetimeFrames < MAX_int32 ? CurrentFrame + LifetimeFrames : MAX_int32;
+	PendingMask |= ToBit(Action);
+}
+
+int32 FRCInputBuffer::RemoveExpired(int32 CurrentFrame)
+{
+	int32 NumExpired = 0;
+	for (int32 Index = 0; Index < Capacity; ++Index)
+	{
+		const ERCBufferedInput Action = static_cast<ERCBufferedInput>(Index);
+		if (Contains(Action) && Entries[Index].ExpireFrame < CurrentFrame)
+		{
+			Remove(Action);
+			++NumExpired;
+		}
+	}
+	return NumExpired;
+}
+
+int32 FRCInputBuffer::GetNextExpireFrame() const
+{
+	int32 NextFrame = MAX_int32;
+	for (int32 Index = 0; Index < Capacity; ++Index)
+	{
+		if (Contains(static_cast<ERCBufferedInput>(Index)))
+		{
+			NextFrame = FMath::Min(NextFrame, Entries[Index].ExpireFrame);
+		}
+	}
+	return NextFrame;
+}
@@ -0,0 +1,61 @@
+// Copyright 2026 Michael DiLucca.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Combat actions that can be buffered while an equip swap is in progress, listed in resolution priority. */
+enum class ERCBufferedInput : uint8
+{
+	Shield,
+	Shoot,
+	ReleaseShoot,
+	Melee,
+	ReleaseMelee,
+
+	Count
+};
+
+/** A single buffered action with when it was buffered and the frame it is discarded. */
+struct FRCBufferedInput
+{
+	int32 BufferedFrame = 0;
+	double BufferedTime = 0.0;
+	int32 ExpireFrame = MAX_int32;
+};
+
+/**
+ * Fixed-capacity buffer of pending combat inputs.
+ * Holds at most one entry per action; buffering an action again refreshes its timestamps.
+ * Entries are resolved in ERCBufferedInput order, highest priority first.
+ */
+class FRCInputBuffer
+{
+public:
+	static constexpr int32 Capacity = static_cast<int32>(ERCBufferedInput::Count);
+
+	/** Buffer an action. LifetimeFrames is how long the entry survives unresolved, MAX_int32 to never expire. */
+	void Push(ERCBufferedInput Action, int32 CurrentFrame, double CurrentTime, int32 LifetimeFrames);
+
+	/** Remove an action from the buffer, if present. */
+	void Remove(ERCBufferedInput Action) { PendingMask &= ~ToBit(Action); }
+
+	/** Remove every pending action. */
+	void Reset() { PendingMask = 0; }
+
+	/** Drop every entry whose expiry frame has passed. Returns the number of entries dropped. */
+	int32 RemoveExpired(int32 CurrentFrame);
+
+	/** Earliest expiry frame of the pending entries, MAX_int32 when none can expire. */
+	int32 GetNextExpireFrame() const;
+
+	bool Contains(ERCBufferedInput Action) const { return (PendingMask & ToBit(Action)) != 0; }
+	bool IsEmpty() const { return PendingMask == 0; }
+	const FRCBufferedInput& Get(ERCBufferedInput Action) const { return Entries[static_cast<int32>(Action)]; }
+
+private:
+	static uint8 ToBit(ERCBufferedInput Action) { return static_cast<uint8>(1u << static_cast<uint8>(Action)); }
+
+	FRCBufferedInput Entries[Capacity];
+	uint8 PendingMask = 0;
+};
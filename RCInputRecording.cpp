@@ -0,0 +1,116 @@
+// Copyright 2026 Michael DiLucca.
+
+#include "RCInputRecording.h"
+
+#include "RCGameplayTimers.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+static TAutoConsoleVariable<FString> CVarInputRecording(
+	TEXT("rc.InputRecording"),
+	TEXT(""),
+	TEXT("File to record locally controlled character input to, relative paths go under Saved/InputRecordings. ")
+	TEXT("Takes effect when the character's input is set up."));
+
+FArchive& operator<<(FArchive& Ar, FRCRecordedInput& Input)
+{
+	uint8 Action = static_cast<uint8>(Input.Action);
+	uint8 TriggerEvent = static_cast<uint8>(Input.TriggerEvent);
+	Ar << Input.Frame << Action << TriggerEvent << Input.QuantizedValue;
+	Input.Action = static_cast<ERCRecordedAction>(Action);
+	Input.TriggerEvent = static_cast<ETriggerEvent>(TriggerEvent);
+	return Ar;
+}
+
+bool FRCInputRecording::SaveToFile(const FString& FilePath) const
+{
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+
+	uint32 Magic = FileMagic;
+	uint16 Version = FileVersion;
+	uint16 Rate = FramesPerSecond;
+	int32 NumEvents = Events.Num();
+	Writer << Magic << Version << Rate << NumEvents;
+	for (FRCRecordedInput Event : Events)
+	{
+		Writer << Event;
+	}
+
+	return FFileHelper::SaveArrayToFile(Bytes, *FilePath);
+}
+
+bool FRCInputRecording::LoadFromFile(const FString& FilePath)
+{
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *FilePath))
+	{
+		return false;
+	}
+
+	FMemoryReader Reader(Bytes);
+	uint32 Magic = 0;
+	uint16 Version = 0;
+	int32 NumEvents = 0;
+	Reader << Magic << Version << FramesPerSecond << NumEvents;
+	if (Magic != FileMagic || Version != FileVersion || NumEvents < 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("%s is not a supported input recording."), *FilePath);
+		return false;
+	}
+
+	Events.SetNum(NumEvents);
+	for (FRCRecordedInput& Event : Events)
+	{
+		Reader << Event;
+	}
+
+	return !Reader.IsError();
+}
+
+FRCInputRecorder::FRCInputRecorder(const FString& InFilePath)
+	: FilePath(FPaths::IsRelative(InFilePath)
+		           ? FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("InputRecordings"), InFilePath)
+		           : InFilePath)
+{
+	Recording.FramesPerSecond = FRCGameplayTimers::FramesPerSecond;
+}
+
+FRCInputRecorder::~FRCInputRecorder()
+{
+	Stop();
+}
+
+FString FRCInputRecorder::GetRequestedFilePath()
+{
+	return CVarInputRecording.GetValueOnGameThread();
+}
+
+void FRCInputRecorder::Record(ERCRecordedAction Action, ETriggerEvent TriggerEvent, float Value, int32 Frame)
+{
+	if (!bIsRecording) return;
+
+	FRCRecordedInput& Input = Recording.Events.AddDefaulted_GetRef();
+	Input.Frame = static_cast<uint32>(FMath::Max(Frame, 0));
+	Input.Action = Action;
+	Input.TriggerEvent = TriggerEvent;
+	Input.SetValue(Value);
+}
+
+void FRCInputRecorder::Stop()
+{
+	if (!bIsRecording) return;
+	bIsRecording = false;
+
+	if (Recording.SaveToFile(FilePath))
+	{
+		UE_LOG(LogTemp, Display, TEXT("Wrote %d input events to %s"), Recording.Events.Num(), *FilePath);
+	}
+	else
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to write input recording to %s"), *FilePath);
+	}
+}
@@ -0,0 +1,81 @@
+// Copyright 2026 Michael DiLucca.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "InputTriggers.h"
+
+/** Character input actions that can be recorded, matching the bindings in ARCCharacter::SetupPlayerInputComponent. */
+enum class ERCRecordedAction : uint8
+{
+	Move,
+	Jump,
+	CrouchDrop,
+	Dash,
+	Ranged,
+	Melee,
+	Shield,
+	Heal,
+
+	Count
+};
+
+/** One recorded input event. 8 bytes on disk. */
+struct FRCRecordedInput
+{
+	/** Quantization of the axis value, enough for movement input well past [-1, 1]. */
+	static constexpr float ValueScale = 256.f;
+
+	uint32 Frame = 0;
+	ERCRecordedAction Action = ERCRecordedAction::Count;
+	ETriggerEvent TriggerEvent = ETriggerEvent::None;
+	int16 QuantizedValue = 0;
+
+	float GetValue() const { return QuantizedValue / ValueScale; }
+	void SetValue(float Value)
+	{
+		QuantizedValue = static_cast<int16>(FMath::Clamp(FMath::RoundToInt32(Value * ValueScale), MIN_int16, MAX_int16));
+	}
+
+	friend FArchive& operator<<(FArchive& Ar, FRCRecordedInput& Input);
+};
+
+/**
+ * A recorded input stream, stamped with gameplay frames (FRCGameplayTimers) so it replays at the rate it was
+ * recorded at. Stored as a small header followed by packed events.
+ */
+struct FRCInputRecording
+{
+	static constexpr uint32 FileMagic = 0x52434952; // 'RCIR'
+	static constexpr uint16 FileVersion = 1;
+
+	uint16 FramesPerSecond = 0;
+	TArray<FRCRecordedInput> Events;
+
+	bool SaveToFile(const FString& FilePath) const;
+	bool LoadFromFile(const FString& FilePath);
+};
+
+/**
+ * Captures the character's input stream while the rc.InputRecording console variable names an output file.
+ * The recording is written when the recorder is destroyed or Stop is called.
+ */
+class FRCInputRecorder
+{
+public:
+	explicit FRCInputRecorder(const FString& InFilePath);
+	~FRCInputRecorder();
+
+	/** Output file requested through rc.InputRecording, empty when recording is off. */
+	static FString GetRequestedFilePath();
+
+	void Record(ERCRecordedAction Action, ETriggerEvent TriggerEvent, float Value, int32 Frame);
+
+	/** Write the recording. Later events are ignored. */
+	void Stop();
+
+private:
+	FString FilePath;
+	FRCInputRecording Recording;
+	bool bIsRecording = true;
+};
@@ -0,0 +1,150 @@
+// Copyright 2026 Michael DiLucca.
+
+#include "RCInputReplayCommandlet.h"
+
+#include "RCCharacter.h"
+#include "RCGameplayTimers.h"
+#include "RCHeadlessWorld.h"
+#include "RCInputRecording.h"
+#include "RCProjectile.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace RCInputReplay
+{
+	/** Heap allocations made so far, where the allocator counts them. */
+	static uint64 GetTotalAllocations()
+	{
+#if !UE_BUILD_SHIPPING
+		return static_cast<uint64>(FMalloc::TotalMallocCalls) + static_cast<uint64>(FMalloc::TotalReallocCalls);
+#else
+		return 0;
+#endif
+	}
+}
+
+URCInputReplayCommandlet::URCInputReplayCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 URCInputReplayCommandlet::Main(const FString& Params)
+{
+	FString RecordingPath;
+	if (!FParse::Value(*Params, TEXT("Recording="), RecordingPath))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Usage: -run=RCInputReplay -Recording=<file> [-Character=<class path>] ")
+		       TEXT("[-Output=<csv>] [-TailFrames=<n>]"));
+		return 1;
+	}
+
+	FRCInputRecording Recording;
+	if (!Recording.LoadFromFile(RecordingPath))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Could not load input recording %s"), *RecordingPath);
+		return 1;
+	}
+	if (Recording.FramesPerSecond != FRCGameplayTimers::FramesPerSecond)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Recording was made at %d frames per second, replaying at %d."),
+		       Recording.FramesPerSecond, FRCGameplayTimers::FramesPerSecond);
+	}
+
+	UClass* CharacterClass = ARCCharacter::StaticClass();
+	FString CharacterClassPath;
+	if (FParse::Value(*Params, TEXT("Character="), CharacterClassPath))
+	{
+		CharacterClass = LoadClass<ARCCharacter>(nullptr, *CharacterClassPath);
+		if (!CharacterClass)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Could not load character class %s"), *CharacterClassPath);
+			return 1;
+		}
+	}
+
+	FString OutputPath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Benchmarks"),
+	                                     FPaths::GetBaseFilename(RecordingPath) + TEXT(".csv"));
+	FParse::Value(*Params, TEXT("Output="), OutputPath);
+
+	int32 TailFrames = FRCGameplayTimers::FramesPerSecond;
+	FParse::Value(*Params, TEXT("TailFrames="), TailFrames);
+
+	FRCHeadlessWorld HeadlessWorld(TEXT("RCInputReplay"));
+	UWorld* World = HeadlessWorld.Get();
+
+	// Count everything spawned while replaying, projectiles separately
+	int32 FrameSpawns = 0;
+	int32 FrameProjectileSpawns = 0;
+	const FDelegateHandle SpawnHandle = World->AddOnActorSpawnedHandler(
+		FOnActorSpawned::FDelegate::CreateLambda([&FrameSpawns, &FrameProjectileSpawns](AActor* Actor)
+		{
+			++FrameSpawns;
+			FrameProjectileSpawns += Actor->IsA<ARCProjectile>() ? 1 : 0;
+		}));
+
+	// Possessed, so replayed movement, jumps and dashes reach the movement component
+	ARCCharacter* Character = Cast<ARCCharacter>(HeadlessWorld.SpawnPossessedPawn(CharacterClass, FVector(0, 0, 200)));
+	if (!Character)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Could not spawn %s"), *GetNameSafe(CharacterClass));
+		World->RemoveOnActorSpawnedHandler(SpawnHandle);
+		return 1;
+	}
+
+	// Replay relative to the first recorded frame
+	const uint32 FirstFrame = Recording.Events.IsEmpty() ? 0 : Recording.Events[0].Frame;
+	const uint32 NumFrames = (Recording.Events.IsEmpty() ? 0 : Recording.Events.Last().Frame - FirstFrame + 1) +
+		TailFrames;
+	const float DeltaSeconds = 1.f / FRCGameplayTimers::FramesPerSecond;
+
+	FString Csv = TEXT("Frame,CpuMs,Allocations,Spawns,ProjectileSpawns\n");
+	TArray<double> FrameMs;
+	FrameMs.Reserve(NumFrames);
+
+	int32 EventIndex = 0;
+	for (uint32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		FrameSpawns = 0;
+		FrameProjectileSpawns = 0;
+		const uint64 StartAllocations = RCInputReplay::GetTotalAllocations();
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+
+		while (EventIndex < Recording.Events.Num() && Recording.Events[EventIndex].Frame - FirstFrame <= Frame)
+		{
+			Character->ReplayRecordedInput(Recording.Events[EventIndex++]);
+		}
+		HeadlessWorld.Tick(DeltaSeconds);
+
+		const double Ms = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+		const uint64 Allocations = RCInputReplay::GetTotalAllocations() - StartAllocations;
+		FrameMs.Add(Ms);
+		Csv += FString::Printf(TEXT("%u,%.4f,%llu,%d,%d\n"), Frame, Ms, Allocations, FrameSpawns,
+		                       FrameProjectileSpawns);
+	}
+
+	World->RemoveOnActorSpawnedHandler(SpawnHandle);
+
+	if (!FFileHelper::SaveStringToFile(Csv, *OutputPath))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Could not write %s"), *OutputPath);
+		return 1;
+	}
+
+	FrameMs.Sort();
+	double TotalMs = 0;
+	for (const double Ms : FrameMs)
+	{
+		TotalMs += Ms;
+	}
+	UE_LOG(LogTemp, Display, TEXT("Replayed %d events over %u frames: mean %.4f ms, p95 %.4f ms, max %.4f ms. ")
+	       TEXT("Per-frame results in %s"), Recording.Events.Num(), NumFrames, TotalMs / FMath::Max<int32>(NumFrames, 1),
+	       FrameMs.IsEmpty() ? 0.0 : FrameMs[FMath::Min(FrameMs.Num() - 1, FrameMs.Num() * 95 / 100)],
+	       FrameMs.IsEmpty() ? 0.0 : FrameMs.Last(), *OutputPath);
+
+	return 0;
+}
@@ -0,0 +1,26 @@
+// Copyright 2026 Michael DiLucca.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "RCInputReplayCommandlet.generated.h"
+
+/**
+ * Replays an input recording (see FRCInputRecorder) against a character in a headless world and reports
+ * per-frame CPU time, heap allocations and actor spawns. For profiling only, the RebelCore.InputReplay automation
+ * tests check what a replay does to the character.
+ *
+ * UnrealEditor-Cmd <Project> -run=RCInputReplay -nullrhi -Recording=<file> [-Character=<class path>]
+ *     [-Output=<csv>] [-TailFrames=<n>]
+ */
+UCLASS()
+class URCInputReplayCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	URCInputReplayCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
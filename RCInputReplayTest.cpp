@@ -0,0 +1,68 @@
+// Copyright 2026 Michael DiLucca.
+
+#include "RCCharacter.h"
+#include "RCGameplayTimers.h"
+#include "RCHeadlessWorld.h"
+#include "RCInputRecording.h"
+#include "Engine/World.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Paths.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRCInputReplayRunAndJumpTest, "RebelCore.InputReplay.RunAndJump",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRCInputReplayRunAndJumpTest::RunTest(const FString& Parameters)
+{
+	// 1.5 s holding right, with a jump pressed half a second in and released a sixth of a second later
+	const FString RecordingPath = FPaths::Combine(FPaths::GetPath(FString(ANSI_TO_TCHAR(__FILE__))), TEXT("TestData"),
+	                                              TEXT("RCInputReplay_RunAndJump.rcinput"));
+	FRCInputRecording Recording;
+	if (!TestTrue(TEXT("Recording loads"), Recording.LoadFromFile(RecordingPath))) return false;
+	if (!TestFalse(TEXT("Recording is empty"), Recording.Events.IsEmpty())) return false;
+	TestEqual(TEXT("Recording frame rate"), static_cast<int32>(Recording.FramesPerSecond),
+	          FRCGameplayTimers::FramesPerSecond);
+
+	FRCHeadlessWorld HeadlessWorld(TEXT("RCInputReplayTest"));
+	ARCCharacter* Character = Cast<ARCCharacter>(
+		HeadlessWorld.SpawnPossessedPawn(ARCCharacter::StaticClass(), FVector(0, 0, 200)));
+	if (!TestNotNull(TEXT("Character"), Character)) return false;
+
+	const float DeltaSeconds = 1.f / FRCGameplayTimers::FramesPerSecond;
+
+	// Settle on the floor before replaying, so the start position is where the run begins
+	for (int32 Frame = 0; Frame < FRCGameplayTimers::FramesPerSecond; ++Frame)
+	{
+		HeadlessWorld.Tick(DeltaSeconds);
+	}
+	const FVector StartLocation = Character->GetActorLocation();
+
+	// Replay relative to the first recorded frame, then give the jump time to land
+	const uint32 FirstFrame = Recording.Events[0].Frame;
+	const uint32 NumFrames = Recording.Events.Last().Frame - FirstFrame + 1 + FRCGameplayTimers::FramesPerSecond;
+	bool bLeftGround = false;
+	int32 EventIndex = 0;
+	for (uint32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		while (EventIndex < Recording.Events.Num() && Recording.Events[EventIndex].Frame - FirstFrame <= Frame)
+		{
+			Character->ReplayRecordedInput(Recording.Events[EventIndex++]);
+		}
+		HeadlessWorld.Tick(DeltaSeconds);
+		bLeftGround |= Character->GetCharacterMovement()->IsFalling();
+	}
+
+	const FVector EndLocation = Character->GetActorLocation();
+	TestTrue(TEXT("Ran right"), EndLocation.X - StartLocation.X > 100.);
+	TestEqual(TEXT("Stayed in the gameplay plane"), EndLocation.Y, StartLocation.Y, 1.);
+	TestTrue(TEXT("Jumped"), bLeftGround);
+	TestTrue(TEXT("Landed"), Character->GetCharacterMovement()->IsMovingOnGround());
+	TestEqual(TEXT("Landed at the start height"), EndLocation.Z, StartLocation.Z, 1.);
+	TestEqual(TEXT("Jump count reset on landing"), Character->JumpCurrentCount, 0);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,177 @@
+// Copyright 2026 Michael DiLucca.
+
+#include "RCLagCompensationSubsystem.h"
+
+#include "RCCharacter.h"
+#include "Components/CapsuleComponent.h"
+#include "Engine/World.h"
+
+int32 URCLagCompensationSubsystem::Register(ARCCharacter* Character)
+{
+	int32 Slot;
+	if (!FreeSlots.IsEmpty())
+	{
+		Slot = FreeSlots.Pop(EAllowShrinking::No);
+		Characters[Slot] = Character;
+	}
+	else
+	{
+		Slot = Characters.Add(Character);
+		if (Slot >= Capacity)
+		{
+			Reserve(FMath::Max(16, Capacity * 2));
+		}
+	}
+	++NumRegistered;
+	return Slot;
+}
+
+void URCLagCompensationSubsystem::Unregister(int32 Slot)
+{
+	if (!Characters.IsValidIndex(Slot) || !Characters[Slot]) return;
+
+	Characters[Slot] = nullptr;
+	FreeSlots.Add(Slot);
+	--NumRegistered;
+
+	// A reused slot must not inherit the previous character's history
+	for (int32 HistoryIndex = 0; HistoryIndex < HistoryLength; ++HistoryIndex)
+	{
+		Samples[HistoryIndex * Capacity + Slot].bIsPresent = false;
+	}
+}
+
+int32 URCLagCompensationSubsystem::RewindQuery(double ServerTime, const FCollisionShape& Shape,
+                                               const FVector& Location,
+                                               TArrayView<FRCLagCompensatedTarget> OutTargets) const
+{
+	if (NumRecorded == 0 || OutTargets.IsEmpty()) return 0;
+
+	// Find the recorded frames either side of ServerTime, walking back from the newest
+	int32 Newer = Head;
+	int32 Older = Head;
+	for (int32 Step = 1; Step < NumRecorded && FrameTimes[Older] > ServerTime; ++Step)
+	{
+		Newer = Older;
+		Older = (Head - Step + HistoryLength) % HistoryLength;
+	}
+	const double Span = FrameTimes[Newer] - FrameTimes[Older];
+	const float Alpha = Span > UE_DOUBLE_SMALL_NUMBER
+		                    ? static_cast<float>(FMath::Clamp((ServerTime - FrameTimes[Older]) / Span, 0.0, 1.0))
+		                    : 1.f;
+
+	// Bound the query shape by a sphere
+	float QueryRadius = 0.f;
+	if (Shape.IsSphere())
+	{
+		QueryRadius = Shape.GetSphereRadius();
+	}
+	else if (Shape.IsCapsule())
+	{
+		QueryRadius = Shape.GetCapsuleHalfHeight();
+	}
+	else if (Shape.IsBox())
+	{
+		QueryRadius = Shape.GetBox().Size();
+	}
+	const FVector3f QueryCenter(Location);
+
+	const FCapsuleSample* RESTRICT OlderFrame = GetFrame(Older);
+	const FCapsuleSample* RESTRICT NewerFrame = GetFrame(Newer);
+	const int32 NumSlots = Characters.Num();
+	int32 NumTargets = 0;
+	for (int32 Slot = 0; Slot < NumSlots && NumTargets < OutTargets.Num(); ++Slot)
+	{
+		const FCapsuleSample& From = OlderFrame[Slot];
+		const FCapsuleSample& To = NewerFrame[Slot];
+		if (!From.bIsPresent && !To.bIsPresent) continue;
+
+		// Only present on one side of ServerTime, it appeared or vanished in between, use the side it was on
+		const FCapsuleSample& Base = From.bIsPresent ? From : To;
+		const FVector3f Center = From.bIsPresent && To.bIsPresent ? FMath::Lerp(From.Center, To.Center, Alpha) : Base.Center;
+
+		// Distance from the query centre to the capsule's axis segment, against both radii
+		const float SegmentHalf = FMath::Max(Base.HalfHeight - Base.Radius, 0.f);
+		const FVector3f ToQuery = QueryCenter - Center;
+		const FVector3f Closest(0.f, 0.f, FMath::Clamp(ToQuery.Z, -SegmentHalf, SegmentHalf));
+		const float Reach = Base.Radius + QueryRadius;
+		if ((ToQuery - Closest).SizeSquared() > Reach * Reach) continue;
+
+		FRCLagCompensatedTarget& Target = OutTargets[NumTargets++];
+		Target.Character = Characters[Slot];
+		Target.Center = FVector(Center);
+		Target.Radius = Base.Radius;
+		Target.HalfHeight = Base.HalfHeight;
+	}
+	return NumTargets;
+}
+
+void URCLagCompensationSubsystem::Tick(float DeltaTime)
+{
+	// Servers ticking faster than the gameplay frame rate would otherwise shrink the window
+	const UWorld* World = GetWorld();
+	const int32 CurrentFrame = FRCGameplayTimers::GetFrame(World);
+	if (CurrentFrame == LastRecordedFrame) return;
+	LastRecordedFrame = CurrentFrame;
+
+	Head = (Head + 1) % HistoryLength;
+	NumRecorded = FMath::Min(NumRecorded + 1, HistoryLength);
+	FrameTimes[Head] = World->GetTimeSeconds();
+
+	FCapsuleSample* RESTRICT Frame = &Samples[Head * Capacity];
+	const int32 NumSlots = Characters.Num();
+	for (int32 Slot = 0; Slot < NumSlots; ++Slot)
+	{
+		FCapsuleSample& Sample = Frame[Slot];
+		const ARCCharacter* Character = Characters[Slot];
+		Sample.bIsPresent = IsValid(Character) && !Character->IsHidden() && Character->GetActorEnableCollision();
+		if (!Sample.bIsPresent) continue;
+
+		const UCapsuleComponent* Capsule = Character->GetCapsuleComponent();
+		Sample.Center = FVector3f(Capsule->GetComponentLocation());
+		Sample.Radius = Capsule->GetScaledCapsuleRadius();
+		Sample.HalfHeight = Capsule->GetScaledCapsuleHalfHeight();
+	}
+}
+
+TStatId URCLagCompensationSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(URCLagCompensationSubsystem, STATGROUP_Tickables);
+}
+
+void URCLagCompensationSubsystem::Deinitialize()
+{
+	Characters.Empty();
+	FreeSlots.Empty();
+	Samples.Empty();
+	NumRegistered = 0;
+	Capacity = 0;
+	Head = INDEX_NONE;
+	NumRecorded = 0;
+	LastRecordedFrame = INDEX_NONE;
+
+	Super::Deinitialize();
+}
+
+bool URCLagCompensationSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void URCLagCompensationSubsystem::Reserve(int32 NewCapacity)
+{
+	// Move each frame's block to the new stride, the added slots start out absent
+	TArray<FCapsuleSample> NewSamples;
+	NewSamples.SetNum(HistoryLength * NewCapacity);
+	if (Capacity > 0)
+	{
+		for (int32 HistoryIndex = 0; HistoryIndex < HistoryLength; ++HistoryIndex)
+		{
+			FMemory::Memcpy(&NewSamples[HistoryIndex * NewCapacity], GetFrame(HistoryIndex),
+			                Capacity * sizeof(FCapsuleSample));
+		}
+	}
+
+	Samples = MoveTemp(NewSamples);
+	Capacity = NewCapacity;
+}
@@ -0,0 +1,87 @@
+// Copyright 2026 Michael DiLucca.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CollisionShape.h"
+#include "RCGameplayTimers.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "RCLagCompensationSubsystem.generated.h"
+
+class ARCCharacter;
+
+/** A character's capsule as it was at a past server time. */
+struct FRCLagCompensatedTarget
+{
+	ARCCharacter* Character = nullptr;
+	FVector Center = FVector::ZeroVector;
+	float Radius = 0.f;
+	float HalfHeight = 0.f;
+};
+
+/**
+ * Server-side capsule history of registered characters, recorded once per gameplay frame into a fixed-size ring
+ * buffer, so the window covers the same time whatever the server tick rate. Each recorded frame is one contiguous
+ * block of capsule samples, so a rewind query reads at most two blocks.
+ * Hidden or non-colliding characters, e.g. dormant pooled ones, are recorded as absent.
+ */
+UCLASS()
+class URCLagCompensationSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** How far back rewind queries can reach. */
+	static constexpr float HistorySeconds = 1.f;
+
+	/** Frames of history kept, enough gameplay frames to span HistorySeconds. */
+	static constexpr int32 HistoryLength = static_cast<int32>(HistorySeconds * FRCGameplayTimers::FramesPerSecond) + 1;
+
+	/** Start recording a character and return its slot, which stays valid until it is unregistered. */
+	int32 Register(ARCCharacter* Character);
+	void Unregister(int32 Slot);
+
+	/**
+	 * Characters whose capsule, as it was at ServerTime, may overlap Shape at Location. Capsules are interpolated
+	 * between the recorded frames around ServerTime, which is clamped to the recorded range. The test is a
+	 * conservative bound of Shape, callers do the exact test against the returned capsules.
+	 * Writes at most OutTargets.Num() targets and returns how many were written. Never allocates.
+	 */
+	int32 RewindQuery(double ServerTime, const FCollisionShape& Shape, const FVector& Location,
+	                  TArrayView<FRCLagCompensatedTarget> OutTargets) const;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return NumRegistered > 0; }
+	virtual TStatId GetStatId() const override;
+	virtual void Deinitialize() override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FCapsuleSample
+	{
+		FVector3f Center = FVector3f::ZeroVector;
+		float Radius = 0.f;
+		float HalfHeight = 0.f;
+		bool bIsPresent = false;
+	};
+
+	/** Grow every frame's block to fit NewCapacity slots, keeping the history recorded so far. */
+	void Reserve(int32 NewCapacity);
+
+	const FCapsuleSample* GetFrame(int32 HistoryIndex) const { return &Samples[HistoryIndex * Capacity]; }
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<ARCCharacter>> Characters;
+	TArray<int32> FreeSlots;
+	int32 NumRegistered = 0;
+
+	/** HistoryLength blocks of Capacity samples each. */
+	TArray<FCapsuleSample> Samples;
+	double FrameTimes[HistoryLength] = {};
+	int32 Capacity = 0;
+	int32 Head = INDEX_NONE;
+	int32 NumRecorded = 0;
+	int32 LastRecordedFrame = INDEX_NONE;
+};
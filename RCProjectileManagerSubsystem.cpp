@@ -0,0 +1,180 @@
+// Copyright 2026 Michael DiLucca.
+
+#include "RCProjectileManagerSubsystem.h"
+
+#include "RCProjectile.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+
+void URCProjectileManagerSubsystem::Launch(ARCProjectile* Projectile, const FVector& Velocity)
+{
+	UPrimitiveComponent* Root = Projectile ? Cast<UPrimitiveComponent>(Projectile->GetRootComponent()) : nullptr;
+	if (!Root) return;
+
+	// A projectile pulled back out of the pool may still be tracked from its previous life
+	Untrack(Projectile);
+
+	const bool bHasGravity = Root->IsGravityEnabled();
+	Root->SetSimulatePhysics(false);
+	Root->ComponentVelocity = FVector(Velocity.X, 0, Velocity.Z);
+
+	const FVector Location = Root->GetComponentLocation();
+	Projectiles.Add(Projectile);
+	PositionX.Add(Location.X);
+	PositionZ.Add(Location.Z);
+	VelocityX.Add(Velocity.X);
+	VelocityZ.Add(Velocity.Z);
+	GravityZ.Add(bHasGravity ? GetWorld()->GetGravityZ() : 0.0);
+	PlaneY.Add(Location.Y);
+	Shapes.Add(Root->GetCollisionShape());
+	LaunchIds.Add(NextLaunchId++);
+}
+
+void URCProjectileManagerSubsystem::Untrack(const ARCProjectile* Projectile)
+{
+	const int32 Index = Projectiles.Find(const_cast<ARCProjectile*>(Projectile));
+	if (Index != INDEX_NONE)
+	{
+		RemoveAtSwap(Index);
+	}
+}
+
+void URCProjectileManagerSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// Last frame's sweeps finished before this frame's tick groups ran
+	DispatchPendingHits();
+
+	const int32 Num = Projectiles.Num();
+	const double Dt = DeltaTime;
+	const double HalfDtSquared = 0.5 * Dt * Dt;
+
+	// Analytic constant-acceleration step over contiguous arrays
+	double* RESTRICT PosX = PositionX.GetData();
+	double* RESTRICT PosZ = PositionZ.GetData();
+	double* RESTRICT VelZ = VelocityZ.GetData();
+	const double* RESTRICT VelX = VelocityX.GetData();
+	const double* RESTRICT Gravity = GravityZ.GetData();
+	for (int32 i = 0; i < Num; ++i)
+	{
+		PosX[i] += VelX[i] * Dt;
+		PosZ[i] += VelZ[i] * Dt + Gravity[i] * HalfDtSquared;
+		VelZ[i] += Gravity[i] * Dt;
+	}
+
+	// Queue a sweep of every projectile's step, destroyed projectiles are dropped back to front
+	UWorld* World = GetWorld();
+	SweptProjectiles.Reset();
+	for (int32 i = Num - 1; i >= 0; --i)
+	{
+		ARCProjectile* Projectile = Projectiles[i];
+		UPrimitiveComponent* Root = IsValid(Projectile)
+			                            ? Cast<UPrimitiveComponent>(Projectile->GetRootComponent())
+			                            : nullptr;
+		if (!Root)
+		{
+			RemoveAtSwap(i);
+			continue;
+		}
+
+		// Step back along the same parabola for the start of the sweep
+		const FVector End(PositionX[i], PlaneY[i], PositionZ[i]);
+		const FVector Start(End.X - VelocityX[i] * Dt, PlaneY[i],
+		                    End.Z - VelocityZ[i] * Dt + GravityZ[i] * HalfDtSquared);
+
+		FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(RCProjectileSweep), false, Projectile);
+		QueryParams.AddIgnoredActor(Projectile->GetInstigator());
+		const FCollisionResponseParams ResponseParams(Root->GetCollisionResponseToChannels());
+
+		World->AsyncSweepByChannel(EAsyncTraceType::Single, Start, End, Root->GetComponentQuat(),
+		                           Root->GetCollisionObjectType(), Shapes[i], QueryParams, ResponseParams,
+		                           &SweepDelegate, SweptProjectiles.Add({Projectile, LaunchIds[i]}));
+
+		Root->SetWorldLocation(End);
+		Root->ComponentVelocity = FVector(VelocityX[i], 0, VelocityZ[i]);
+	}
+}
+
+void URCProjectileManagerSubsystem::OnSweepCompleted(const FTraceHandle& Handle, FTraceDatum& Datum)
+{
+	if (!SweptProjectiles.IsValidIndex(Datum.UserData)) return;
+
+	for (const FHitResult& Hit : Datum.OutHits)
+	{
+		if (Hit.bBlockingHit)
+		{
+			PendingHits.Add({SweptProjectiles[Datum.UserData], Hit});
+			return;
+		}
+	}
+}
+
+void URCProjectileManagerSubsystem::DispatchPendingHits()
+{
+	// Hit handling may release, relaunch or destroy projectiles, so nothing here walks the tracked arrays
+	for (const FPendingHit& Pending : PendingHits)
+	{
+		ARCProjectile* Projectile = Pending.Swept.Projectile.Get();
+		const int32 Index = Projectile ? Projectiles.Find(Projectile) : INDEX_NONE;
+		if (Index == INDEX_NONE || LaunchIds[Index] != Pending.Swept.LaunchId) continue;
+
+		UPrimitiveComponent* Root = Cast<UPrimitiveComponent>(Projectile->GetRootComponent());
+		if (!Root) continue;
+
+		// Back to where it struck, then stop driving it before anything reacts to the hit
+		Root->SetWorldLocation(Pending.Hit.Location);
+		Root->ComponentVelocity = FVector(VelocityX[Index], 0, VelocityZ[Index]);
+		RemoveAtSwap(Index);
+		Root->DispatchBlockingHit(*Projectile, Pending.Hit);
+	}
+	PendingHits.Reset();
+}
+
+TStatId URCProjectileManagerSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(URCProjectileManagerSubsystem, STATGROUP_Tickables);
+}
+
+void URCProjectileManagerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	SweepDelegate.BindUObject(this, &URCProjectileManagerSubsystem::OnSweepCompleted);
+}
+
+void URCProjectileManagerSubsystem::Deinitialize()
+{
+	Projectiles.Empty();
+	PositionX.Empty();
+	PositionZ.Empty();
+	VelocityX.Empty();
+	VelocityZ.Empty();
+	GravityZ.Empty();
+	PlaneY.Empty();
+	Shapes.Empty();
+	LaunchIds.Empty();
+	SweepDelegate.Unbind();
+	SweptProjectiles.Empty();
+	PendingHits.Empty();
+
+	Super::Deinitialize();
+}
+
+bool URCProjectileManagerSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void URCProjectileManagerSubsystem::RemoveAtSwap(int32 Index)
+{
+	Projectiles.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	PositionX.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	PositionZ.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	VelocityX.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	VelocityZ.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	GravityZ.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	PlaneY.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Shapes.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	LaunchIds.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+}
@@ -0,0 +1,85 @@
+// Copyright 2026 Michael DiLucca.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CollisionShape.h"
+#include "WorldCollision.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "RCProjectileManagerSubsystem.generated.h"
+
+class ARCProjectile;
+
+/**
+ * Moves launched projectiles kinematically in the X/Z gameplay plane instead of through rigid-body simulation.
+ * Live projectiles are held in a structure-of-arrays layout and integrated analytically in one pass per frame,
+ * after which every projectile's step is swept through the world's async trace batch on the physics worker threads.
+ * Results come back at the start of the next frame; blocking hits are dispatched to the projectile the same way a
+ * simulated body's hit would be, so existing hit handling keeps working.
+ */
+UCLASS()
+class URCProjectileManagerSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Start moving a projectile. Its root stops simulating physics; Velocity is in the X/Z plane. */
+	void Launch(ARCProjectile* Projectile, const FVector& Velocity);
+
+	/** Stop moving a projectile, e.g. when it goes back to the projectile pool. */
+	void Untrack(const ARCProjectile* Projectile);
+
+	int32 GetNumProjectiles() const { return Projectiles.Num(); }
+
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return !Projectiles.IsEmpty() || !PendingHits.IsEmpty(); }
+	virtual TStatId GetStatId() const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/** A projectile swept this frame, matched back to its trace by user data. */
+	struct FSweptProjectile
+	{
+		TWeakObjectPtr<ARCProjectile> Projectile;
+		uint32 LaunchId = 0;
+	};
+
+	struct FPendingHit
+	{
+		FSweptProjectile Swept;
+		FHitResult Hit;
+	};
+
+	void OnSweepCompleted(const FTraceHandle& Handle, FTraceDatum& Datum);
+
+	/** Dispatch last frame's blocking hits to projectiles still on the flight they were swept for. */
+	void DispatchPendingHits();
+
+	void RemoveAtSwap(int32 Index);
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<ARCProjectile>> Projectiles;
+
+	// Hot simulation state, one entry per projectile
+	TArray<double> PositionX;
+	TArray<double> PositionZ;
+	TArray<double> VelocityX;
+	TArray<double> VelocityZ;
+	TArray<double> GravityZ;
+
+	// Cold per-projectile data only needed for sweeps
+	TArray<double> PlaneY;
+	TArray<FCollisionShape> Shapes;
+
+	/** Per projectile, which launch it is on, so a hit for a previous flight is never applied to a reused one. */
+	TArray<uint32> LaunchIds;
+	uint32 NextLaunchId = 1;
+
+	FTraceDelegate SweepDelegate;
+	TArray<FSweptProjectile> SweptProjectiles;
+	TArray<FPendingHit> PendingHits;
+};
@@ -0,0 +1,220 @@
+// Copyright 2026 Michael DiLucca.
+
+#include "RCProjectilePoolSubsystem.h"
+
+#include "RCProjectile.h"
+#include "RCProjectileManagerSubsystem.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Pool Hits"), STAT_RCProjectilePoolHits, STATGROUP_RCProjectilePool);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Pool Misses"), STAT_RCProjectilePoolMisses, STATGROUP_RCProjectilePool);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Pool Releases"), STAT_RCProjectilePoolReleases, STATGROUP_RCProjectilePool);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Dormant Projectiles"), STAT_RCProjectilePoolDormant, STATGROUP_RCProjectilePool);
+
+void URCProjectilePoolSubsystem::Prewarm(TSubclassOf<ARCProjectile> ProjectileClass, int32 Count, AActor* Owner,
+                                         APawn* Instigator)
+{
+	if (!ProjectileClass) return;
+
+	FRCProjectilePool& Pool = GetPool(ProjectileClass);
+	while (Pool.Available.Num() < Count)
+	{
+		ARCProjectile* Projectile = SpawnProjectile(ProjectileClass, Pool, Owner, Instigator);
+		if (!Projectile) return;
+
+		Deactivate(Projectile);
+		Pool.Available.Add(Projectile);
+		INC_DWORD_STAT(STAT_RCProjectilePoolDormant);
+	}
+}
+
+ARCProjectile* URCProjectilePoolSubsystem::Acquire(TSubclassOf<ARCProjectile> ProjectileClass,
+                                                   const FTransform& Transform, AActor* NewOwner,
+                                                   APawn* NewInstigator, bool bKinematic)
+{
+	if (!ProjectileClass) return nullptr;
+
+	FRCProjectilePool& Pool = GetPool(ProjectileClass);
+
+	// Pooled projectiles can still be destroyed by other code, skip any that were
+	ARCProjectile* Projectile = nullptr;
+	while (!Projectile && !Pool.Available.IsEmpty())
+	{
+		Projectile = Pool.Available.Pop(EAllowShrinking::No);
+		DEC_DWORD_STAT(STAT_RCProjectilePoolDormant);
+		if (!IsValid(Projectile))
+		{
+			Projectile = nullptr;
+		}
+	}
+
+	if (Projectile)
+	{
+		INC_DWORD_STAT(STAT_RCProjectilePoolHits);
+	}
+	else
+	{
+		INC_DWORD_STAT(STAT_RCProjectilePoolMisses);
+		Projectile = SpawnProjectile(ProjectileClass, Pool, NewOwner, NewInstigator);
+		if (!Projectile) return nullptr;
+	}
+
+	Projectile->SetOwner(NewOwner);
+	Projectile->SetInstigator(NewInstigator);
+	Activate(Projectile, Pool, Transform, bKinematic);
+
+	FTimerHandle& ExpiryTimer = ActiveProjectiles.Add(Projectile);
+	if (Pool.LifeSpan > 0.f)
+	{
+		GetWorld()->GetTimerManager().SetTimer(
+			ExpiryTimer, FTimerDelegate::CreateUObject(this, &URCProjectilePoolSubsystem::ReleaseDeferred,
+			                                           TWeakObjectPtr<ARCProjectile>(Projectile)),
+			Pool.LifeSpan, false);
+	}
+	return Projectile;
+}
+
+void URCProjectilePoolSubsystem::Release(ARCProjectile* Projectile)
+{
+	FTimerHandle ExpiryTimer;
+	if (!IsValid(Projectile) || !ActiveProjectiles.RemoveAndCopyValue(Projectile, ExpiryTimer)) return;
+
+	GetWorld()->GetTimerManager().ClearTimer(ExpiryTimer);
+
+	if (URCProjectileManagerSubsystem* ProjectileManager = GetWorld()->GetSubsystem<URCProjectileManagerSubsystem>())
+	{
+		ProjectileManager->Untrack(Projectile);
+	}
+
+	Deactivate(Projectile);
+	Projectile->SetOwner(nullptr);
+	Projectile->SetInstigator(nullptr);
+	GetPool(Projectile->GetClass()).Available.Add(Projectile);
+	INC_DWORD_STAT(STAT_RCProjectilePoolReleases);
+	INC_DWORD_STAT(STAT_RCProjectilePoolDormant);
+}
+
+void URCProjectilePoolSubsystem::Deinitialize()
+{
+	for (const TPair<TObjectPtr<UClass>, FRCProjectilePool>& Pair : Pools)
+	{
+		DEC_DWORD_STAT_BY(STAT_RCProjectilePoolDormant, Pair.Value.Available.Num());
+	}
+	Pools.Empty();
+
+	if (FTimerManager* TimerManager = GetWorld() ? &GetWorld()->GetTimerManager() : nullptr)
+	{
+		TimerManager->ClearAllTimersForObject(this);
+	}
+	ActiveProjectiles.Empty();
+
+	Super::Deinitialize();
+}
+
+bool URCProjectilePoolSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+FRCProjectilePool& URCProjectilePoolSubsystem::GetPool(UClass* ProjectileClass)
+{
+	return Pools.FindOrAdd(ProjectileClass);
+}
+
+ARCProjectile* URCProjectilePoolSubsystem::SpawnProjectile(UClass* ProjectileClass, FRCProjectilePool& Pool,
+                                                           AActor* Owner, APawn* Instigator) const
+{
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.Owner = Owner;
+	SpawnParameters.Instigator = Instigator;
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	ARCProjectile* Projectile = GetWorld()->SpawnActor<ARCProjectile>(ProjectileClass, FTransform::Identity,
+	                                                                  SpawnParameters);
+	if (!Projectile)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Projectile pool failed to spawn %s!"), *GetNameSafe(ProjectileClass));
+		return nullptr;
+	}
+
+	// Remember what a fresh projectile looks like so reused ones can be put back the same way
+	if (!Pool.bIsInitialized)
+	{
+		const UPrimitiveComponent* Root = Cast<UPrimitiveComponent>(Projectile->GetRootComponent());
+		Pool.bRootSimulatesPhysics = Root && Root->IsSimulatingPhysics();
+		Pool.LifeSpan = Projectile->InitialLifeSpan;
+		Pool.bReleaseOnHit = Projectile->bReleaseToPoolOnHit;
+		Pool.bIsInitialized = true;
+	}
+
+	// The pool times the projectile out itself, an actor lifespan would destroy it instead
+	Projectile->SetLifeSpan(0.f);
+
+	// Single-hit classes come back to the pool on their first hit, kinematic projectiles dispatch theirs through the
+	// root as well
+	UPrimitiveComponent* Root = Cast<UPrimitiveComponent>(Projectile->GetRootComponent());
+	if (Pool.bReleaseOnHit && Root)
+	{
+		Root->OnComponentHit.AddDynamic(this, &URCProjectilePoolSubsystem::OnProjectileHit);
+	}
+
+	return Projectile;
+}
+
+void URCProjectilePoolSubsystem::Activate(ARCProjectile* Projectile, const FRCProjectilePool& Pool,
+                                          const FTransform& Transform, bool bKinematic)
+{
+	Projectile->SetActorTransform(Transform, false, nullptr, ETeleportType::ResetPhysics);
+
+	if (UPrimitiveComponent* Root = Cast<UPrimitiveComponent>(Projectile->GetRootComponent()))
+	{
+		Root->SetSimulatePhysics(Pool.bRootSimulatesPhysics && !bKinematic);
+		Root->SetPhysicsLinearVelocity(FVector::ZeroVector);
+		Root->SetPhysicsAngularVelocityInDegrees(FVector::ZeroVector);
+	}
+
+	Projectile->SetActorHiddenInGame(false);
+	Projectile->SetActorEnableCollision(true);
+	Projectile->SetActorTickEnabled(true);
+}
+
+void URCProjectilePoolSubsystem::Deactivate(ARCProjectile* Projectile)
+{
+	if (UPrimitiveComponent* Root = Cast<UPrimitiveComponent>(Projectile->GetRootComponent()))
+	{
+		Root->SetPhysicsLinearVelocity(FVector::ZeroVector);
+		Root->SetPhysicsAngularVelocityInDegrees(FVector::ZeroVector);
+		Root->SetSimulatePhysics(false);
+	}
+
+	Projectile->SetActorHiddenInGame(true);
+	Projectile->SetActorEnableCollision(false);
+	Projectile->SetActorTickEnabled(false);
+}
+
+void URCProjectilePoolSubsystem::ReleaseDeferred(TWeakObjectPtr<ARCProjectile> Projectile)
+{
+	if (Projectile.IsValid())
+	{
+		Release(Projectile.Get());
+	}
+	else
+	{
+		ActiveProjectiles.Remove(Projectile);
+	}
+}
+
+void URCProjectilePoolSubsystem::OnProjectileHit(UPrimitiveComponent* HitComponent, AActor* OtherActor,
+                                                 UPrimitiveComponent* OtherComp, FVector NormalImpulse,
+                                                 const FHitResult& Hit)
+{
+	// Let the projectile's own hit handling finish with it still active, then take it back next frame
+	ARCProjectile* Projectile = Cast<ARCProjectile>(HitComponent->GetOwner());
+	if (!IsAcquired(Projectile)) return;
+
+	GetWorld()->GetTimerManager().SetTimerForNextTick(
+		FTimerDelegate::CreateUObject(this, &URCProjectilePoolSubsystem::ReleaseDeferred,
+		                              TWeakObjectPtr<ARCProjectile>(Projectile)));
+}
@@ -0,0 +1,101 @@
+// Copyright 2026 Michael DiLucca.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/TimerHandle.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Templates/SubclassOf.h"
+#include "RCProjectilePoolSubsystem.generated.h"
+
+class ARCProjectile;
+
+DECLARE_STATS_GROUP(TEXT("RCProjectilePool"), STATGROUP_RCProjectilePool, STATCAT_Advanced);
+
+/** Inactive projectiles of a single class, plus the state needed to bring one back to life. */
+USTRUCT()
+struct FRCProjectilePool
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<TObjectPtr<ARCProjectile>> Available;
+
+	/** Whether the projectile's root simulates physics when freshly spawned. */
+	bool bRootSimulatesPhysics = false;
+
+	/** Seconds an acquired projectile lives before the pool takes it back, 0 to live until released. */
+	float LifeSpan = 0.f;
+
+	/** Whether the class opted into going back to the pool the frame after its first hit. */
+	bool bReleaseOnHit = false;
+
+	bool bIsInitialized = false;
+};
+
+/**
+ * Per-world pool of ARCProjectile actors, keyed by projectile class.
+ * Acquire reuses a dormant projectile when one is available and only spawns on a miss.
+ * The class's InitialLifeSpan becomes a pool timer instead of an actor lifespan, so an expired projectile goes back
+ * to the pool. Otherwise projectiles decide their own end of life and call Release, so bouncing and piercing ones
+ * keep working. Classes with bReleaseToPoolOnHit go back the frame after their first hit instead.
+ */
+UCLASS()
+class URCProjectilePoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Make sure at least Count dormant projectiles of the class are ready. New ones are spawned with Owner and
+	 * Instigator, usually the actor that is going to fire them, so their construction and BeginPlay see a shooter.
+	 */
+	void Prewarm(TSubclassOf<ARCProjectile> ProjectileClass, int32 Count, AActor* Owner = nullptr,
+	             APawn* Instigator = nullptr);
+
+	/**
+	 * Take a projectile from the pool, spawning one on a miss, and place it at Transform with its physics reset.
+	 * The owner and instigator are set on every acquire, and passed to the spawn on a miss.
+	 * Kinematic projectiles are moved by URCProjectileManagerSubsystem, so their root is left not simulating.
+	 */
+	ARCProjectile* Acquire(TSubclassOf<ARCProjectile> ProjectileClass, const FTransform& Transform, AActor* NewOwner,
+	                       APawn* NewInstigator, bool bKinematic = false);
+
+	/**
+	 * Put an acquired projectile back into the pool of its class. It is hidden, made non-colliding and stops ticking.
+	 * Projectiles that are not currently acquired are ignored, so releasing twice is harmless.
+	 */
+	void Release(ARCProjectile* Projectile);
+
+	bool IsAcquired(const ARCProjectile* Projectile) const
+	{
+		return ActiveProjectiles.Contains(const_cast<ARCProjectile*>(Projectile));
+	}
+
+	virtual void Deinitialize() override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	FRCProjectilePool& GetPool(UClass* ProjectileClass);
+	ARCProjectile* SpawnProjectile(UClass* ProjectileClass, FRCProjectilePool& Pool, AActor* Owner,
+	                               APawn* Instigator) const;
+
+	static void Activate(ARCProjectile* Projectile, const FRCProjectilePool& Pool, const FTransform& Transform,
+	                     bool bKinematic);
+	static void Deactivate(ARCProjectile* Projectile);
+
+	/** Release from a timer, the projectile may have been destroyed in the meantime. */
+	void ReleaseDeferred(TWeakObjectPtr<ARCProjectile> Projectile);
+
+	UFUNCTION()
+	void OnProjectileHit(UPrimitiveComponent* HitComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp,
+	                     FVector NormalImpulse, const FHitResult& Hit);
+
+	UPROPERTY(Transient)
+	TMap<TObjectPtr<UClass>, FRCProjectilePool> Pools;
+
+	/** Acquired projectiles and their expiry timers, weak since other code may still destroy a projectile. */
+	TMap<TWeakObjectPtr<ARCProjectile>, FTimerHandle> ActiveProjectiles;
+};
@@ -0,0 +1,62 @@
+// Copyright 2026 Michael DiLucca.
+
+#include "RCGameplayTimers.h"
+#include "RCHeadlessWorld.h"
+#include "RCProjectile.h"
+#include "RCProjectilePoolSubsystem.h"
+#include "Engine/World.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRCProjectilePoolExpiryTest, "RebelCore.ProjectilePool.ExpiryReturnsToPool",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FRCProjectilePoolExpiryTest::RunTest(const FString& Parameters)
+{
+	// Fresh spawns pick their lifespan up from the class default
+	constexpr float LifeSpan = 0.1f;
+	TGuardValue<float> LifeSpanGuard(GetMutableDefault<ARCProjectile>()->InitialLifeSpan, LifeSpan);
+
+	FRCHeadlessWorld HeadlessWorld(TEXT("RCProjectilePoolTest"));
+	URCProjectilePoolSubsystem* ProjectilePool = HeadlessWorld.Get()->GetSubsystem<URCProjectilePoolSubsystem>();
+	if (!TestNotNull(TEXT("Projectile pool"), ProjectilePool)) return false;
+
+	const float DeltaSeconds = 1.f / FRCGameplayTimers::FramesPerSecond;
+	const auto TickFor = [&HeadlessWorld, DeltaSeconds](float Seconds)
+	{
+		for (float Elapsed = 0.f; Elapsed < Seconds; Elapsed += DeltaSeconds)
+		{
+			HeadlessWorld.Tick(DeltaSeconds);
+		}
+	};
+
+	ARCProjectile* First = ProjectilePool->Acquire(ARCProjectile::StaticClass(), FTransform::Identity, nullptr,
+	                                               nullptr);
+	if (!TestNotNull(TEXT("Acquired projectile"), First)) return false;
+	TestTrue(TEXT("Acquired projectile is active"), ProjectilePool->IsAcquired(First));
+	TestEqual(TEXT("Acquired projectile has no actor lifespan"), First->GetLifeSpan(), 0.f);
+
+	// Running out its life returns it to the pool instead of destroying it
+	TickFor(LifeSpan * 2.f);
+	TestTrue(TEXT("Expired projectile survives"), IsValid(First));
+	TestFalse(TEXT("Expired projectile is back in the pool"), ProjectilePool->IsAcquired(First));
+	TestTrue(TEXT("Expired projectile is hidden"), First->IsHidden());
+
+	ARCProjectile* Second = ProjectilePool->Acquire(ARCProjectile::StaticClass(), FTransform::Identity, nullptr,
+	                                                nullptr);
+	TestEqual(TEXT("Re-acquire reuses the expired projectile"), Second, First);
+	TestFalse(TEXT("Re-acquired projectile is visible"), Second->IsHidden());
+
+	// Releasing early cancels the expiry, the next life gets its full lifespan
+	ProjectilePool->Release(Second);
+	ARCProjectile* Third = ProjectilePool->Acquire(ARCProjectile::StaticClass(), FTransform::Identity, nullptr,
+	                                               nullptr);
+	TestEqual(TEXT("Re-acquire after release reuses the projectile"), Third, First);
+	TickFor(LifeSpan * 0.5f);
+	TestTrue(TEXT("Released expiry doesn't cut the next life short"), ProjectilePool->IsAcquired(Third));
+
+	return true;
+}
+
+#endif
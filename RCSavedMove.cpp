@@ -0,0 +1,86 @@
+// Copyright 2026 Michael DiLucca.
+
+#include "RCSavedMove.h"
+
+#include "RCCharacterMovementComponent.h"
+#include "GameFramework/Character.h"
+
+void FSavedMove_RC::Clear()
+{
+	Super::Clear();
+
+	bWantsToDash = false;
+	bWantsToPlatformDrop = false;
+	bWasWallSliding = false;
+	bWasDashing = false;
+}
+
+uint8 FSavedMove_RC::GetCompressedFlags() const
+{
+	uint8 Flags = Super::GetCompressedFlags();
+	if (bWantsToDash)
+	{
+		Flags |= FLAG_Dash;
+	}
+	if (bWantsToPlatformDrop)
+	{
+		Flags |= FLAG_PlatformDrop;
+	}
+	return Flags;
+}
+
+bool FSavedMove_RC::CanCombineWith(const FSavedMovePtr& NewMove, ACharacter* InCharacter, float MaxDelta) const
+{
+	// Intents are edges, merging moves would drop or duplicate them
+	const FSavedMove_RC* NewRCMove = static_cast<const FSavedMove_RC*>(NewMove.Get());
+	if (bWantsToDash != NewRCMove->bWantsToDash
+		|| bWantsToPlatformDrop != NewRCMove->bWantsToPlatformDrop
+		|| bWasWallSliding != NewRCMove->bWasWallSliding
+		|| bWasDashing != NewRCMove->bWasDashing)
+	{
+		return false;
+	}
+
+	return Super::CanCombineWith(NewMove, InCharacter, MaxDelta);
+}
+
+void FSavedMove_RC::SetMoveFor(ACharacter* C, float InDeltaTime, FVector const& NewAccel,
+                               FNetworkPredictionData_Client_Character& ClientData)
+{
+	Super::SetMoveFor(C, InDeltaTime, NewAccel, ClientData);
+
+	const URCCharacterMovementComponent* MovementComponent = Cast<URCCharacterMovementComponent>(
+		C->GetCharacterMovement());
+	if (!MovementComponent) return;
+
+	bWantsToDash = MovementComponent->WantsToDash;
+	bWantsToPlatformDrop = MovementComponent->WantsToPlatformDrop;
+	bWasWallSliding = MovementComponent->IsWallsliding;
+	bWasDashing = MovementComponent->IsDashing;
+}
+
+void FSavedMove_RC::PrepMoveFor(ACharacter* C)
+{
+	Super::PrepMoveFor(C);
+
+	URCCharacterMovementComponent* MovementComponent = Cast<URCCharacterMovementComponent>(
+		C->GetCharacterMovement());
+	if (!MovementComponent) return;
+
+	// Put back what the move started with so the replay takes the same branch it did the first time
+	MovementComponent->WantsToDash = bWantsToDash;
+	MovementComponent->WantsToPlatformDrop = bWantsToPlatformDrop;
+	MovementComponent->IsWallsliding = bWasWallSliding;
+	MovementComponent->IsDashing = bWasDashing;
+}
+
+void FSavedMove_RC::UpdateFromCompressedFlags(URCCharacterMovementComponent* MovementComponent, uint8 Flags)
+{
+	MovementComponent->WantsToDash = (Flags & FLAG_Dash) != 0;
+	MovementComponent->WantsToPlatformDrop = (Flags & FLAG_PlatformDrop) != 0;
+}
+
+FSavedMovePtr FNetworkPredictionData_Client_RC::AllocateNewMove()
+{
+	return MakeShared<FSavedMove_RC>();
+}
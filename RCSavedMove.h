@@ -0,0 +1,54 @@
+// Copyright 2026 Michael DiLucca.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/CharacterMovementComponent.h"
+
+class URCCharacterMovementComponent;
+
+/**
+ * Saved move carrying the RebelCore movement intents, so clients predict dash and platform drop instead of
+ * waiting on the server. Dash and drop requests ride in the custom compressed flags; the wallslide and dash
+ * states are restored before a move is replayed after a correction.
+ */
+class FSavedMove_RC : public FSavedMove_Character
+{
+public:
+	typedef FSavedMove_Character Super;
+
+	enum ECustomCompressedFlags : uint8
+	{
+		FLAG_Dash = FLAG_Custom_0,
+		FLAG_PlatformDrop = FLAG_Custom_1,
+	};
+
+	virtual void Clear() override;
+	virtual uint8 GetCompressedFlags() const override;
+	virtual bool CanCombineWith(const FSavedMovePtr& NewMove, ACharacter* InCharacter, float MaxDelta) const override;
+	virtual void SetMoveFor(ACharacter* C, float InDeltaTime, FVector const& NewAccel,
+	                        FNetworkPredictionData_Client_Character& ClientData) override;
+	virtual void PrepMoveFor(ACharacter* C) override;
+
+	/** Apply the intents a client sent to the server's movement component. */
+	static void UpdateFromCompressedFlags(URCCharacterMovementComponent* MovementComponent, uint8 Flags);
+
+	bool bWantsToDash = false;
+	bool bWantsToPlatformDrop = false;
+	bool bWasWallSliding = false;
+	bool bWasDashing = false;
+};
+
+/** Client prediction data that allocates FSavedMove_RC. */
+class FNetworkPredictionData_Client_RC : public FNetworkPredictionData_Client_Character
+{
+public:
+	typedef FNetworkPredictionData_Client_Character Super;
+
+	explicit FNetworkPredictionData_Client_RC(const UCharacterMovementComponent& ClientMovement)
+		: Super(ClientMovement)
+	{
+	}
+
+	virtual FSavedMovePtr AllocateNewMove() override;
+};
@@ -0,0 +1,36 @@
+// Copyright 2026 Michael DiLucca.
+
+#include "RCShieldComponent.h"
+
+URCShieldComponent::URCShieldComponent(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	PrimaryComponentTick.bCanEverTick = false;
+	SetGenerateOverlapEvents(false);
+	CanCharacterStepUpOn = ECB_No;
+	SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	SetVisibility(false);
+}
+
+void URCShieldComponent::OnRegister()
+{
+	// The profile would reset the collision state, so it is applied before the raised state is
+	SetCollisionProfileName(ShieldCollisionProfile, false);
+	SetCollisionEnabled(bIsRaised ? ECollisionEnabled::QueryAndPhysics : ECollisionEnabled::NoCollision);
+
+	Super::OnRegister();
+}
+
+void URCShieldComponent::SetShieldRaised(bool bRaised)
+{
+	if (bIsRaised == bRaised) return;
+
+	bIsRaised = bRaised;
+	SetCollisionEnabled(bRaised ? ECollisionEnabled::QueryAndPhysics : ECollisionEnabled::NoCollision);
+}
+
+bool URCShieldComponent::IsShieldHit(const FHitResult& Hit)
+{
+	const URCShieldComponent* Shield = Cast<URCShieldComponent>(Hit.GetComponent());
+	return Shield && Shield->IsShieldRaised();
+}
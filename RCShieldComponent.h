@@ -0,0 +1,40 @@
+// Copyright 2026 Michael DiLucca.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/StaticMeshComponent.h"
+#include "RCShieldComponent.generated.h"
+
+/**
+ * Shield equippable that lives on the character instead of being a separately spawned actor.
+ * Hidden and without collision until it is raised; while raised it blocks with ShieldCollisionProfile.
+ */
+UCLASS(ClassGroup=(RebelCore), meta=(BlueprintSpawnableComponent))
+class URCShieldComponent : public UStaticMeshComponent
+{
+	GENERATED_BODY()
+
+public:
+	URCShieldComponent(const FObjectInitializer& ObjectInitializer);
+
+	/** Enable or disable blocking. Collision state is only touched when it changes. */
+	void SetShieldRaised(bool bRaised);
+	bool IsShieldRaised() const { return bIsRaised; }
+
+	/**
+	 * True if Hit landed on a raised shield. Hits on the shield report the wielder as the hit actor, so hit handlers
+	 * check this to block instead of applying damage to the wielder.
+	 */
+	static bool IsShieldHit(const FHitResult& Hit);
+
+	/** Collision profile used while the shield is raised. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Shield")
+	FName ShieldCollisionProfile = TEXT("BlockAllDynamic");
+
+protected:
+	virtual void OnRegister() override;
+
+private:
+	bool bIsRaised = false;
+};
@@ -0,0 +1,148 @@
+// Copyright 2026 Michael DiLucca.
+
+#include "RCSignificanceSubsystem.h"
+
+#include "RCCharacter.h"
+#include "SignificanceManager.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+
+static const FName RCCharacterSignificanceTag(TEXT("RCCharacter"));
+
+FRCSignificanceSettings::FRCSignificanceSettings()
+{
+	Mid.bAnimUpdateRateOptimizations = true;
+
+	Far.bAnimUpdateRateOptimizations = true;
+	Far.MovementTickInterval = 1.f / 20.f;
+	Far.bOnlyTickMontagesWhenNotRendered = true;
+
+	Hidden.bAnimUpdateRateOptimizations = true;
+	Hidden.MeshTickInterval = 1.f / 10.f;
+	Hidden.MovementTickInterval = 1.f / 10.f;
+	Hidden.bOnlyTickMontagesWhenNotRendered = true;
+}
+
+const FRCSignificanceTierSettings& FRCSignificanceSettings::Get(ERCSignificanceTier Tier) const
+{
+	switch (Tier)
+	{
+	case ERCSignificanceTier::Mid: return Mid;
+	case ERCSignificanceTier::Far: return Far;
+	case ERCSignificanceTier::Hidden: return Hidden;
+	default: return Near;
+	}
+}
+
+void URCSignificanceSubsystem::Register(ARCCharacter* Character)
+{
+	USignificanceManager* SignificanceManager = USignificanceManager::Get(GetWorld());
+	if (!SignificanceManager) return;
+
+	SignificanceManager->RegisterObject(
+		Character, RCCharacterSignificanceTag,
+		[this](USignificanceManager::FManagedObjectInfo* ObjectInfo, const FTransform& Viewpoint)
+		{
+			return CalculateSignificance(CastChecked<ARCCharacter>(ObjectInfo->GetObject()), Viewpoint);
+		},
+		USignificanceManager::EPostSignificanceType::Sequential,
+		[](USignificanceManager::FManagedObjectInfo* ObjectInfo, float OldSignificance, float Significance, bool bFinal)
+		{
+			// The final call comes from unregistering at EndPlay, leave the ticks of an actor on its way out alone
+			ARCCharacter* Character = Cast<ARCCharacter>(ObjectInfo->GetObject());
+			if (bFinal || !IsValid(Character) || Character->IsActorBeingDestroyed()) return;
+
+			// Significance is the tier counted down from Hidden, an unchanged tier is ignored by the character
+			const int32 Tier = static_cast<int32>(ERCSignificanceTier::Hidden) - FMath::RoundToInt32(Significance);
+			Character->SetSignificanceTier(static_cast<ERCSignificanceTier>(Tier));
+		});
+	++NumRegistered;
+}
+
+void URCSignificanceSubsystem::Unregister(ARCCharacter* Character)
+{
+	USignificanceManager* SignificanceManager = USignificanceManager::Get(GetWorld());
+	if (!SignificanceManager || !SignificanceManager->GetManagedObject(Character)) return;
+
+	SignificanceManager->UnregisterObject(Character);
+	--NumRegistered;
+}
+
+void URCSignificanceSubsystem::Tick(float DeltaTime)
+{
+	USignificanceManager* SignificanceManager = USignificanceManager::Get(GetWorld());
+	if (!SignificanceManager) return;
+
+	// Remote players' view points are known on the server too, so every player controller counts
+	ViewTargets.Reset();
+	Viewpoints.Reset();
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PlayerController = It->Get();
+		if (!PlayerController) continue;
+
+		FVector ViewLocation;
+		FRotator ViewRotation;
+		PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+		Viewpoints.Emplace(ViewRotation, ViewLocation);
+		ViewTargets.Add(PlayerController->GetViewTarget());
+	}
+	bUseVisibility = GetWorld()->GetNetMode() != NM_DedicatedServer;
+
+	SignificanceManager->Update(Viewpoints);
+}
+
+TStatId URCSignificanceSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(URCSignificanceSubsystem, STATGROUP_Tickables);
+}
+
+void URCSignificanceSubsystem::Deinitialize()
+{
+	if (USignificanceManager* SignificanceManager = USignificanceManager::Get(GetWorld()))
+	{
+		SignificanceManager->UnregisterAll(RCCharacterSignificanceTag);
+	}
+	NumRegistered = 0;
+
+	Super::Deinitialize();
+}
+
+bool URCSignificanceSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+float URCSignificanceSubsystem::CalculateSignificance(const ARCCharacter* Character, const FTransform& Viewpoint) const
+{
+	ERCSignificanceTier Tier;
+	if (Character->IsHidden())
+	{
+		Tier = ERCSignificanceTier::Hidden;
+	}
+	else if (ViewTargets.Contains(Character))
+	{
+		Tier = ERCSignificanceTier::Viewed;
+	}
+	else
+	{
+		const FRCSignificanceSettings& Settings = Character->GetSignificanceSettings();
+		const double DistanceSquared = FVector::DistSquared(Viewpoint.GetLocation(), Character->GetActorLocation());
+		if (DistanceSquared <= FMath::Square(Settings.NearDistance))
+		{
+			// Close enough to come on screen with a turn of the camera, keep it current either way
+			Tier = ERCSignificanceTier::Near;
+		}
+		else if (bUseVisibility && !Character->WasRecentlyRendered())
+		{
+			Tier = ERCSignificanceTier::Hidden;
+		}
+		else
+		{
+			Tier = DistanceSquared <= FMath::Square(Settings.MidDistance)
+				       ? ERCSignificanceTier::Mid
+				       : ERCSignificanceTier::Far;
+		}
+	}
+	return static_cast<float>(static_cast<int32>(ERCSignificanceTier::Hidden) - static_cast<int32>(Tier));
+}
@@ -0,0 +1,109 @@
+// Copyright 2026 Michael DiLucca.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "RCSignificanceSubsystem.generated.h"
+
+class ARCCharacter;
+
+/** How much a character matters to the players, most significant first. */
+UENUM(BlueprintType)
+enum class ERCSignificanceTier : uint8
+{
+	/** A player's view target, always updated at full rate with its follow camera active. */
+	Viewed,
+	Near,
+	Mid,
+	Far,
+	/** Off-screen and out of Near range, or hidden, e.g. dormant in the character pool. */
+	Hidden
+};
+
+/** Update rates applied to a character in one significance tier. */
+USTRUCT(BlueprintType)
+struct FRCSignificanceTierSettings
+{
+	GENERATED_BODY()
+
+	/** Let the mesh skip animation updates by screen size. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Significance")
+	bool bAnimUpdateRateOptimizations = false;
+
+	/** Seconds between mesh ticks, 0 to tick every frame. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Significance", meta = (ClampMin = "0"))
+	float MeshTickInterval = 0.f;
+
+	/** Seconds between movement ticks for characters no player controls, 0 to tick every frame. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Significance", meta = (ClampMin = "0"))
+	float MovementTickInterval = 0.f;
+
+	/** Only tick montages while the mesh is not rendered, so montage notifies and end events still fire. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Significance")
+	bool bOnlyTickMontagesWhenNotRendered = false;
+};
+
+/** Distances that split characters into significance tiers, and what each tier updates at. */
+USTRUCT(BlueprintType)
+struct FRCSignificanceSettings
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Significance", meta = (ClampMin = "0"))
+	float NearDistance = 1500.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Significance", meta = (ClampMin = "0"))
+	float MidDistance = 4000.f;
+
+	/** Viewed characters share the Near settings. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Significance")
+	FRCSignificanceTierSettings Near;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Significance")
+	FRCSignificanceTierSettings Mid;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Significance")
+	FRCSignificanceTierSettings Far;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Significance")
+	FRCSignificanceTierSettings Hidden;
+
+	FRCSignificanceSettings();
+
+	const FRCSignificanceTierSettings& Get(ERCSignificanceTier Tier) const;
+};
+
+/**
+ * Feeds every player's view point to the world's significance manager each frame and sorts registered
+ * characters into significance tiers by distance, on-screen visibility and whether a player is viewing them.
+ * Characters are handed their tier when it changes, see ARCCharacter::SetSignificanceTier.
+ * Dedicated servers render nothing, so there characters are tiered by distance alone.
+ */
+UCLASS()
+class URCSignificanceSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	void Register(ARCCharacter* Character);
+	void Unregister(ARCCharacter* Character);
+
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return NumRegistered > 0; }
+	virtual TStatId GetStatId() const override;
+	virtual void Deinitialize() override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/** Significance of Character from one view point, the tier counted down from Hidden. */
+	float CalculateSignificance(const ARCCharacter* Character, const FTransform& Viewpoint) const;
+
+	/** Players' view targets this frame, always in the Viewed tier. */
+	TArray<const AActor*, TInlineAllocator<4>> ViewTargets;
+	TArray<FTransform, TInlineAllocator<4>> Viewpoints;
+	bool bUseVisibility = true;
+	int32 NumRegistered = 0;
+};